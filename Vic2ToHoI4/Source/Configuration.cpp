@@ -165,6 +165,36 @@ Configuration::Factory::Factory()
 			 std::clamp(static_cast<float>(commonItems::singleDouble{theStream}.getDouble()), 0.0F, 100.0F) / 100.0F;
 		Log(LogLevel::Info) << "\tPercent of commanders: " << configuration->percentOfCommanders;
 	});
+	registerKeyword("threads", [this](std::istream& theStream) {
+		configuration->numberOfThreads = static_cast<unsigned int>(std::max(commonItems::singleInt{theStream}.getInt(), 0));
+		Log(LogLevel::Info) << "\tThreads: " << configuration->numberOfThreads;
+	});
+	registerKeyword("cache_map_data", [this](std::istream& theStream) {
+		const commonItems::singleString cacheMapDataValue(theStream);
+		if (cacheMapDataValue.getString() == "no")
+		{
+			configuration->cacheMapData = false;
+			Log(LogLevel::Info) << "\tDisabling map data cache";
+		}
+		else
+		{
+			configuration->cacheMapData = true;
+			Log(LogLevel::Info) << "\tEnabling map data cache";
+		}
+	});
+	registerKeyword("cache_flags", [this](std::istream& theStream) {
+		const commonItems::singleString cacheFlagsValue(theStream);
+		if (cacheFlagsValue.getString() == "no")
+		{
+			configuration->cacheFlags = false;
+			Log(LogLevel::Info) << "\tDisabling flag cache";
+		}
+		else
+		{
+			configuration->cacheFlags = true;
+			Log(LogLevel::Info) << "\tEnabling flag cache";
+		}
+	});
 	registerKeyword("output_name", [this](const std::string& unused, std::istream& theStream) {
 		configuration->customOutputName = commonItems::singleString(theStream).getString();
 	});
@@ -44,6 +44,9 @@ class Configuration
 	[[nodiscard]] const auto& getRemoveCores() const { return removeCores; }
 	[[nodiscard]] const auto& getCreateFactions() const { return createFactions; }
 	[[nodiscard]] const auto& getPercentOfCommanders() const { return percentOfCommanders; }
+	[[nodiscard]] const auto& getNumberOfThreads() const { return numberOfThreads; }
+	[[nodiscard]] const auto& getCacheMapData() const { return cacheMapData; }
+	[[nodiscard]] const auto& getCacheFlags() const { return cacheFlags; }
 
 	[[nodiscard]] auto getNextLeaderID() { return leaderID++; }
 
@@ -70,6 +73,9 @@ class Configuration
 	bool removeCores = true;
 	bool createFactions = true;
 	float percentOfCommanders = 0.05F;
+	unsigned int numberOfThreads = 0; // 0 means use every hardware thread
+	bool cacheMapData = true;
+	bool cacheFlags = true;
 
 	// set later
 	unsigned int leaderID = 1000;
@@ -130,6 +136,21 @@ class Configuration::Builder
 		configuration->removeCores = removeCores;
 		return *this;
 	}
+	Builder& setNumberOfThreads(unsigned int numberOfThreads)
+	{
+		configuration->numberOfThreads = numberOfThreads;
+		return *this;
+	}
+	Builder& setCacheMapData(bool cacheMapData)
+	{
+		configuration->cacheMapData = cacheMapData;
+		return *this;
+	}
+	Builder& setCacheFlags(bool cacheFlags)
+	{
+		configuration->cacheFlags = cacheFlags;
+		return *this;
+	}
 
   private:
 	std::unique_ptr<Configuration> configuration;
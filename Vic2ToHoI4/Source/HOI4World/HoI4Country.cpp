@@ -24,6 +24,7 @@
 
 HoI4::Country::Country(std::string tag,
 	 const Vic2::Country& sourceCountry,
+	 const Vic2::Issues& vic2Issues,
 	 Names& names,
 	 Mappers::GraphicsMapper& graphicsMapper,
 	 const Mappers::CountryMapper& countryMap,
@@ -72,10 +73,17 @@ HoI4::Country::Country(std::string tag,
 
 	if (sourceCountry.hasLand())
 	{
-		auto warAttitude = sourceCountry.getAverageIssueSupport("jingoism");
-		warAttitude += sourceCountry.getAverageIssueSupport("pro_military") / 2;
-		warAttitude -= sourceCountry.getAverageIssueSupport("anti_military") / 2;
-		warAttitude -= sourceCountry.getAverageIssueSupport("pacifism");
+		const auto getAverageIssueSupport = [&sourceCountry, &vic2Issues](const std::string& issueName) {
+			if (const auto issueNumber = vic2Issues.getIssueNumber(issueName); issueNumber)
+			{
+				return sourceCountry.getAverageIssueSupport(*issueNumber);
+			}
+			return 0.0F;
+		};
+		auto warAttitude = getAverageIssueSupport("jingoism");
+		warAttitude += getAverageIssueSupport("pro_military") / 2;
+		warAttitude -= getAverageIssueSupport("anti_military") / 2;
+		warAttitude -= getAverageIssueSupport("pacifism");
 		warSupport += static_cast<int>(
 			 (warAttitude * 0.375) + (sourceCountry.getRevanchism() / 5.0) - (sourceCountry.getWarExhaustion() / 2.5));
 		if (warSupport < 15)
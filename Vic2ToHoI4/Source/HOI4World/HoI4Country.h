@@ -55,6 +55,7 @@ class Country
   public:
 	explicit Country(std::string tag,
 		 const Vic2::Country& sourceCountry,
+		 const Vic2::Issues& vic2Issues,
 		 Names& names,
 		 Mappers::GraphicsMapper& graphicsMapper,
 		 const Mappers::CountryMapper& countryMap,
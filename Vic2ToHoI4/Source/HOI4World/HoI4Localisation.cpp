@@ -4,6 +4,7 @@
 #include "Log.h"
 #include "Mappers/Government/GovernmentMapper.h"
 #include "OSCompatibilityLayer.h"
+#include "ParallelFor.h"
 #include "States/HoI4State.h"
 #include "States/HoI4States.h"
 #include "V2World/Countries/Country.h"
@@ -37,68 +38,60 @@ std::unique_ptr<HoI4::Localisation> HoI4::Localisation::Importer::generateLocali
 
 void HoI4::Localisation::Importer::importLocalisations(const Configuration& theConfiguration)
 {
-	for (const auto& fileName: commonItems::GetAllFilesInFolder(theConfiguration.getHoI4Path() + "/localisation"))
+	// the install's files come first, so their localisations are kept over blankmod's
+	std::vector<std::pair<std::string, languageToLocalisationsMap*>> files;
+	addLocalisationFilesInFolder(theConfiguration.getHoI4Path() + "/localisation", files);
+	addLocalisationFilesInFolder("blankmod/output/localisation", files);
+
+	// files are read at the same time, then added in order so the same localisations win as when read one by one
+	std::vector<std::optional<std::pair<language, keyToLocalisationMap>>> fileLocalisations(files.size());
+	forEachInParallel(files.size(), theConfiguration.getNumberOfThreads(), [&files, &fileLocalisations](size_t file) {
+		fileLocalisations[file] = readLocalisationFile(files[file].first);
+	});
+
+	for (size_t file = 0; file < files.size(); file++)
 	{
-		if (fileName.substr(0, 5) == "focus")
-		{
-			importFocusLocalisations(theConfiguration.getHoI4Path() + "/localisation/" + fileName);
-		}
-		else if (fileName.substr(0, 5) == "ideas")
+		if (!fileLocalisations[file])
 		{
-			importGenericIdeaLocalisations(theConfiguration.getHoI4Path() + "/localisation/" + fileName);
-		}
-		else if (fileName.substr(0, 6) == "events")
-		{
-			importEventLocalisations(theConfiguration.getHoI4Path() + "/localisation/" + fileName);
+			Log(LogLevel::Error) << "Could not open " << files[file].first;
+			exit(-1);
 		}
+		auto& [fileLanguage, newLocalisations] = *fileLocalisations[file];
+		addLocalisations(fileLanguage, std::move(newLocalisations), *files[file].second);
 	}
+}
 
-	for (const auto& fileName: commonItems::GetAllFilesInFolder("blankmod/output/localisation"))
+
+void HoI4::Localisation::Importer::addLocalisationFilesInFolder(const std::string& folder,
+	 std::vector<std::pair<std::string, languageToLocalisationsMap*>>& files)
+{
+	for (const auto& fileName: commonItems::GetAllFilesInFolder(folder))
 	{
 		if (fileName.substr(0, 5) == "focus")
 		{
-			importFocusLocalisations("blankmod/output/localisation/" + fileName);
+			files.emplace_back(folder + "/" + fileName, &originalFocuses);
 		}
 		else if (fileName.substr(0, 5) == "ideas")
 		{
-			importGenericIdeaLocalisations("blankmod/output/localisation/" + fileName);
+			files.emplace_back(folder + "/" + fileName, &genericIdeaLocalisations);
 		}
 		else if (fileName.substr(0, 6) == "events")
 		{
-			importEventLocalisations("blankmod/output/localisation/" + fileName);
+			files.emplace_back(folder + "/" + fileName, &originalEventLocalisations);
 		}
 	}
 }
 
 
-void HoI4::Localisation::Importer::importFocusLocalisations(const std::string& filename)
-{
-	importLocalisationFile(filename, originalFocuses);
-}
-
-
-void HoI4::Localisation::Importer::importGenericIdeaLocalisations(const std::string& filename)
-{
-	importLocalisationFile(filename, genericIdeaLocalisations);
-}
-
-
-void HoI4::Localisation::Importer::importEventLocalisations(const std::string& filename)
-{
-	importLocalisationFile(filename, originalEventLocalisations);
-}
-
-
-void HoI4::Localisation::Importer::importLocalisationFile(const std::string& filename,
-	 languageToLocalisationsMap& localisations)
+std::optional<std::pair<HoI4::language, HoI4::keyToLocalisationMap>>
+HoI4::Localisation::Importer::readLocalisationFile(const std::string& filename)
 {
 	keyToLocalisationMap newLocalisations;
 
 	std::ifstream file(filename);
 	if (!file.is_open())
 	{
-		Log(LogLevel::Error) << "Could not open " << filename;
-		exit(-1);
+		return std::nullopt;
 	}
 	char bitBucket[3];
 	file.read(bitBucket, sizeof bitBucket);
@@ -129,10 +122,20 @@ void HoI4::Localisation::Importer::importLocalisationFile(const std::string& fil
 		newLocalisations[key] = value;
 	}
 
-	auto localisationsInLanguage = localisations.find(language);
+	file.close();
+
+	return std::make_pair(std::move(language), std::move(newLocalisations));
+}
+
+
+void HoI4::Localisation::Importer::addLocalisations(const language& fileLanguage,
+	 keyToLocalisationMap newLocalisations,
+	 languageToLocalisationsMap& localisations)
+{
+	auto localisationsInLanguage = localisations.find(fileLanguage);
 	if (localisationsInLanguage == localisations.end())
 	{
-		localisations[language] = newLocalisations;
+		localisations[fileLanguage] = std::move(newLocalisations);
 	}
 	else
 	{
@@ -141,8 +144,6 @@ void HoI4::Localisation::Importer::importLocalisationFile(const std::string& fil
 			localisationsInLanguage->second.insert(localisation);
 		}
 	}
-
-	file.close();
 }
 
 
@@ -567,7 +568,7 @@ bool HoI4::Localisation::sourceStateHasAllButOneProvinceFromDefinition(const Vic
 	 const Vic2::StateDefinitions& theStateDefinitions)
 {
 	return sourceState.getProvinces().size() ==
-			 theStateDefinitions.getAllProvinces(*sourceState.getProvinceNumbers().begin()).size() - 1;
+			 theStateDefinitions.getStateProvinces(*sourceState.getProvinceNumbers().begin()).size() - 1;
 }
 
 
@@ -578,8 +579,7 @@ bool HoI4::Localisation::stateHasAllDefinedProvincesAfterConversion(const State&
 {
 	std::set<int> stateDefinitionDefinitionProvinces;
 
-	auto stateDefinitionSourceProvinces = theStateDefinitions.getAllProvinces(*sourceState.getProvinceNumbers().begin());
-	for (auto sourceProvince: stateDefinitionSourceProvinces)
+	for (auto sourceProvince: theStateDefinitions.getStateProvinces(*sourceState.getProvinceNumbers().begin()))
 	{
 		for (auto HoI4Province: theProvinceMapper.getVic2ToHoI4ProvinceMapping(sourceProvince))
 		{
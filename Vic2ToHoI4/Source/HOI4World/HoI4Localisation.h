@@ -17,6 +17,8 @@
 #include <map>
 #include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 
 
@@ -200,10 +202,12 @@ class Localisation::Importer
 
   private:
 	void importLocalisations(const Configuration& theConfiguration);
-	void importFocusLocalisations(const std::string& filename);
-	void importGenericIdeaLocalisations(const std::string& filename);
-	void importEventLocalisations(const std::string& filename);
-	static void importLocalisationFile(const std::string& filename, languageToLocalisationsMap& localisations);
+	void addLocalisationFilesInFolder(const std::string& folder,
+		 std::vector<std::pair<std::string, languageToLocalisationsMap*>>& files);
+	static std::optional<std::pair<language, keyToLocalisationMap>> readLocalisationFile(const std::string& filename);
+	static void addLocalisations(const language& fileLanguage,
+		 keyToLocalisationMap newLocalisations,
+		 languageToLocalisationsMap& localisations);
 	void prepareBlankLocalisations();
 
 	std::map<language, std::map<stateNumber, std::string>> stateLocalisations;
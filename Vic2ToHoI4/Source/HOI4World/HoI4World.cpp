@@ -104,7 +104,7 @@ HoI4::World::World(const Vic2::World& sourceWorld,
 		 provinceMapper,
 		 theConfiguration);
 	supplyZones = new HoI4::SupplyZones(states->getDefaultStates(), theConfiguration);
-	buildings = new Buildings(*states, theCoastalProvinces, *theMapData, provinceDefinitions, theConfiguration);
+	buildings = new Buildings(*states, theCoastalProvinces, *theMapData, theConfiguration);
 	addStatesToCountries(provinceMapper);
 	states->addCapitalsToStates(countries);
 	intelligenceAgencies = IntelligenceAgencies::Factory::createIntelligenceAgencies(countries, *names);
@@ -212,7 +212,7 @@ void HoI4::World::convertCountries(const Vic2::World& sourceWorld)
 
 	for (const auto& [tag, country]: sourceWorld.getCountries())
 	{
-		convertCountry(tag, country, *flagsToIdeasMapper);
+		convertCountry(tag, country, sourceWorld.getIssues(), *flagsToIdeasMapper);
 	}
 
 	int numHumanCountries = 0;
@@ -233,6 +233,7 @@ void HoI4::World::convertCountries(const Vic2::World& sourceWorld)
 
 void HoI4::World::convertCountry(const std::string& oldTag,
 	 const Vic2::Country& oldCountry,
+	 const Vic2::Issues& vic2Issues,
 	 const Mappers::FlagsToIdeasMapper& flagsToIdeasMapper)
 {
 	// don't convert rebels
@@ -251,6 +252,7 @@ void HoI4::World::convertCountry(const std::string& oldTag,
 	{
 		destCountry = new HoI4::Country(*possibleHoI4Tag,
 			 oldCountry,
+			 vic2Issues,
 			 *names,
 			 *graphicsMapper,
 			 *countryMap,
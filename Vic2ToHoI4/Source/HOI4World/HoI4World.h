@@ -124,6 +124,7 @@ class World: commonItems::parser
 	void convertCountries(const Vic2::World& sourceWorld);
 	void convertCountry(const std::string& oldTag,
 		 const Vic2::Country& oldCountry,
+		 const Vic2::Issues& vic2Issues,
 		 const Mappers::FlagsToIdeasMapper& flagsToIdeasMapper);
 
 	void importLeaderTraits();
@@ -12,19 +12,16 @@
 HoI4::Buildings::Buildings(const States& theStates,
 	 const CoastalProvinces& theCoastalProvinces,
 	 MapData& theMapData,
-	 const ProvinceDefinitions& provinceDefinitions,
 	 const Configuration& theConfiguration)
 {
 	Log(LogLevel::Info) << "\tCreating buildings";
 
-	importDefaultBuildings(theMapData, provinceDefinitions, theConfiguration);
+	importDefaultBuildings(theMapData, theConfiguration);
 	placeBuildings(theStates, theCoastalProvinces, theMapData, theConfiguration);
 }
 
 
-void HoI4::Buildings::importDefaultBuildings(MapData& theMapData,
-	 const ProvinceDefinitions& provinceDefinitions,
-	 const Configuration& theConfiguration)
+void HoI4::Buildings::importDefaultBuildings(MapData& theMapData, const Configuration& theConfiguration)
 {
 	std::ifstream buildingsFile(theConfiguration.getHoI4Path() + "/map/buildings.txt");
 	if (!buildingsFile.is_open())
@@ -36,14 +33,12 @@ void HoI4::Buildings::importDefaultBuildings(MapData& theMapData,
 	{
 		std::string line;
 		getline(buildingsFile, line);
-		processLine(line, theMapData, provinceDefinitions);
+		processLine(line, theMapData);
 	}
 }
 
 
-void HoI4::Buildings::processLine(const std::string& line,
-	 MapData& theMapData,
-	 const ProvinceDefinitions& provinceDefinitions)
+void HoI4::Buildings::processLine(const std::string& line, MapData& theMapData)
 {
 	const std::regex pattern("(.+);(.+);(.+);(.+);(.+);(.+);(.+)");
 	std::smatch matches;
@@ -51,43 +46,43 @@ void HoI4::Buildings::processLine(const std::string& line,
 	{
 		if (matches[2] == "arms_factory")
 		{
-			importDefaultBuilding(matches, defaultArmsFactories, theMapData, provinceDefinitions);
+			importDefaultBuilding(matches, defaultArmsFactories, theMapData);
 		}
 		else if (matches[2] == "industrial_complex")
 		{
-			importDefaultBuilding(matches, defaultIndustrialComplexes, theMapData, provinceDefinitions);
+			importDefaultBuilding(matches, defaultIndustrialComplexes, theMapData);
 		}
 		else if (matches[2] == "air_base")
 		{
-			importDefaultBuilding(matches, defaultAirBases, theMapData, provinceDefinitions);
+			importDefaultBuilding(matches, defaultAirBases, theMapData);
 		}
 		else if (matches[2] == "naval_base")
 		{
-			importDefaultBuilding(matches, defaultNavalBases, theMapData, provinceDefinitions);
+			importDefaultBuilding(matches, defaultNavalBases, theMapData);
 		}
 		else if (matches[2] == "bunker")
 		{
-			importDefaultBuilding(matches, defaultBunkers, theMapData, provinceDefinitions);
+			importDefaultBuilding(matches, defaultBunkers, theMapData);
 		}
 		else if (matches[2] == "coastal_bunker")
 		{
-			importDefaultBuilding(matches, defaultCoastalBunkers, theMapData, provinceDefinitions);
+			importDefaultBuilding(matches, defaultCoastalBunkers, theMapData);
 		}
 		else if (matches[2] == "dockyard")
 		{
-			importDefaultBuilding(matches, defaultDockyards, theMapData, provinceDefinitions);
+			importDefaultBuilding(matches, defaultDockyards, theMapData);
 		}
 		else if (matches[2] == "anti_air_building")
 		{
-			importDefaultBuilding(matches, defaultAntiAirs, theMapData, provinceDefinitions);
+			importDefaultBuilding(matches, defaultAntiAirs, theMapData);
 		}
 		else if (matches[2] == "synthetic_refinery")
 		{
-			importDefaultBuilding(matches, defaultSyntheticRefineries, theMapData, provinceDefinitions);
+			importDefaultBuilding(matches, defaultSyntheticRefineries, theMapData);
 		}
 		else if (matches[2] == "nuclear_reactor")
 		{
-			importDefaultBuilding(matches, defaultNuclearReactors, theMapData, provinceDefinitions);
+			importDefaultBuilding(matches, defaultNuclearReactors, theMapData);
 		}
 	}
 }
@@ -95,8 +90,7 @@ void HoI4::Buildings::processLine(const std::string& line,
 
 void HoI4::Buildings::importDefaultBuilding(const std::smatch& matches,
 	 defaultPositions& positions,
-	 MapData& theMapData,
-	 const ProvinceDefinitions& provinceDefinitions) const
+	 MapData& theMapData) const
 {
 	BuildingPosition position;
 	position.xCoordinate = stof(matches[3].str());
@@ -106,7 +100,7 @@ void HoI4::Buildings::importDefaultBuilding(const std::smatch& matches,
 
 	auto connectingSeaProvince = stoi(matches[7].str());
 
-	auto province = theMapData.getProvinceNumber(position.xCoordinate, position.zCoordinate, provinceDefinitions);
+	auto province = theMapData.getProvinceNumber(position.xCoordinate, position.zCoordinate);
 	if (province)
 	{
 		const auto key = std::make_pair(*province, connectingSeaProvince);
@@ -160,14 +154,12 @@ void HoI4::Buildings::placeArmsFactories(const States& theStates, const MapData&
 		{
 			for (auto theProvince: state.second.getProvinces())
 			{
-				auto theProvincePoints = theMapData.getProvincePoints(theProvince);
-				if (theProvincePoints)
+				if (const auto centermostPoint = theMapData.getProvinceCenter(theProvince))
 				{
-					const auto centermostPoint = theProvincePoints->getCentermostPoint();
 					BuildingPosition thePosition;
-					thePosition.xCoordinate = centermostPoint.first;
+					thePosition.xCoordinate = centermostPoint->first;
 					thePosition.yCoordinate = 11.0;
-					thePosition.zCoordinate = centermostPoint.second;
+					thePosition.zCoordinate = centermostPoint->second;
 					thePosition.rotation = 0;
 					buildings.insert(std::make_pair(state.first, Building(state.first, "arms_factory", thePosition, 0)));
 					numPlaced++;
@@ -215,14 +207,12 @@ void HoI4::Buildings::placeIndustrialComplexes(const States& theStates, const Ma
 		{
 			for (auto theProvince: state.second.getProvinces())
 			{
-				auto theProvincePoints = theMapData.getProvincePoints(theProvince);
-				if (theProvincePoints)
+				if (const auto centermostPoint = theMapData.getProvinceCenter(theProvince))
 				{
-					const auto centermostPoint = theProvincePoints->getCentermostPoint();
 					BuildingPosition thePosition;
-					thePosition.xCoordinate = centermostPoint.first;
+					thePosition.xCoordinate = centermostPoint->first;
 					thePosition.yCoordinate = 11.0;
-					thePosition.zCoordinate = centermostPoint.second;
+					thePosition.zCoordinate = centermostPoint->second;
 					thePosition.rotation = 0;
 					buildings.insert(
 						 std::make_pair(state.first, Building(state.first, "industrial_complex", thePosition, 0)));
@@ -269,14 +259,12 @@ void HoI4::Buildings::placeAirports(const States& theStates, const MapData& theM
 			auto theProvince = *state.second.getProvinces().begin();
 			airportLocations.insert(std::make_pair(state.first, theProvince));
 
-			auto theProvincePoints = theMapData.getProvincePoints(theProvince);
-			if (theProvincePoints)
+			if (const auto centermostPoint = theMapData.getProvinceCenter(theProvince))
 			{
-				const auto centermostPoint = theProvincePoints->getCentermostPoint();
 				BuildingPosition thePosition;
-				thePosition.xCoordinate = centermostPoint.first;
+				thePosition.xCoordinate = centermostPoint->first;
 				thePosition.yCoordinate = 11.0;
-				thePosition.zCoordinate = centermostPoint.second;
+				thePosition.zCoordinate = centermostPoint->second;
 				thePosition.rotation = 0;
 				buildings.insert(std::make_pair(state.first, Building(state.first, "air_base", thePosition, 0)));
 			}
@@ -316,14 +304,12 @@ void HoI4::Buildings::placeAntiAir(const States& theStates, const MapData& theMa
 		{
 			for (auto theProvince: state.second.getProvinces())
 			{
-				auto theProvincePoints = theMapData.getProvincePoints(theProvince);
-				if (theProvincePoints)
+				if (const auto centermostPoint = theMapData.getProvinceCenter(theProvince))
 				{
-					const auto centermostPoint = theProvincePoints->getCentermostPoint();
 					BuildingPosition thePosition;
-					thePosition.xCoordinate = centermostPoint.first;
+					thePosition.xCoordinate = centermostPoint->first;
 					thePosition.yCoordinate = 11.0;
-					thePosition.zCoordinate = centermostPoint.second;
+					thePosition.zCoordinate = centermostPoint->second;
 					thePosition.rotation = 0;
 					buildings.insert(
 						 std::make_pair(state.first, Building(state.first, "anti_air_building", thePosition, 0)));
@@ -615,14 +601,12 @@ void HoI4::Buildings::placeSyntheticRefineries(const States& theStates, const Ma
 		if (!refineryPlaced)
 		{
 			const auto theProvince = *state.second.getProvinces().begin();
-			auto theProvincePoints = theMapData.getProvincePoints(theProvince);
-			if (theProvincePoints)
+			if (const auto centermostPoint = theMapData.getProvinceCenter(theProvince))
 			{
-				const auto centermostPoint = theProvincePoints->getCentermostPoint();
 				BuildingPosition thePosition;
-				thePosition.xCoordinate = centermostPoint.first;
+				thePosition.xCoordinate = centermostPoint->first;
 				thePosition.yCoordinate = 11.0;
-				thePosition.zCoordinate = centermostPoint.second;
+				thePosition.zCoordinate = centermostPoint->second;
 				thePosition.rotation = 0;
 				buildings.insert(std::make_pair(state.first, Building(state.first, "synthetic_refinery", thePosition, 0)));
 			}
@@ -657,14 +641,12 @@ void HoI4::Buildings::placeNuclearReactors(const States& theStates, const MapDat
 		if (!reactorPlaced)
 		{
 			const auto theProvince = *state.second.getProvinces().begin();
-			auto theProvincePoints = theMapData.getProvincePoints(theProvince);
-			if (theProvincePoints)
+			if (const auto centermostPoint = theMapData.getProvinceCenter(theProvince))
 			{
-				const auto centermostPoint = theProvincePoints->getCentermostPoint();
 				BuildingPosition thePosition;
-				thePosition.xCoordinate = centermostPoint.first;
+				thePosition.xCoordinate = centermostPoint->first;
 				thePosition.yCoordinate = 11.0;
-				thePosition.zCoordinate = centermostPoint.second;
+				thePosition.zCoordinate = centermostPoint->second;
 				thePosition.rotation = 0;
 				buildings.insert(std::make_pair(state.first, Building(state.first, "nuclear_reactor", thePosition, 0)));
 			}
@@ -7,7 +7,6 @@
 #include "Configuration.h"
 #include "HOI4World/Map/CoastalProvinces.h"
 #include "HOI4World/Map/MapData.h"
-#include "HOI4World/ProvinceDefinitions.h"
 #include "HOI4World/States/HoI4States.h"
 #include "Hoi4Building.h"
 #include <map>
@@ -30,21 +29,15 @@ class Buildings
 	explicit Buildings(const States& theStates,
 		 const CoastalProvinces& theCoastalProvinces,
 		 MapData& theMapData,
-		 const ProvinceDefinitions& provinceDefinitions,
 		 const Configuration& theConfiguration);
 
 	[[nodiscard]] const auto& getBuildings() const { return buildings; }
 	[[nodiscard]] const auto& getAirportLocations() const { return airportLocations; }
 
   private:
-	void importDefaultBuildings(MapData& theMapData,
-		 const ProvinceDefinitions& provinceDefinitions,
-		 const Configuration& theConfiguration);
-	void processLine(const std::string& line, MapData& theMapData, const ProvinceDefinitions& provinceDefinitions);
-	void importDefaultBuilding(const std::smatch& matches,
-		 defaultPositions& positions,
-		 MapData& theMapData,
-		 const ProvinceDefinitions& provinceDefinitions) const;
+	void importDefaultBuildings(MapData& theMapData, const Configuration& theConfiguration);
+	void processLine(const std::string& line, MapData& theMapData);
+	void importDefaultBuilding(const std::smatch& matches, defaultPositions& positions, MapData& theMapData) const;
 
 	void placeBuildings(const States& theStates,
 		 const CoastalProvinces& theCoastalProvinces,
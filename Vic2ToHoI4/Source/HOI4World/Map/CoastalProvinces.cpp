@@ -18,7 +18,7 @@ void HoI4::CoastalProvinces::init(const MapData& theMapData, const std::map<int,
 			continue;
 		}
 
-		auto neighbors = theMapData.getNeighbors(province.first);
+		const auto& neighbors = theMapData.getNeighbors(province.first);
 		for (auto adjProvinceNum: neighbors)
 		{
 			if (auto adjProvince = theProvinces.find(adjProvinceNum);
@@ -3,165 +3,565 @@
 #include "Configuration.h"
 #include "HOI4World/ProvinceDefinitions.h"
 #include "Log.h"
+#include "ParallelFor.h"
+#include "bitmap_image.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <random>
+#include <thread>
 
 
 
-commonItems::Color getCenterColor(point position, bitmap_image& provinceMap);
-commonItems::Color getAboveColor(point position, bitmap_image& provinceMap);
-commonItems::Color getBelowColor(point position, int height, bitmap_image& provinceMap);
-commonItems::Color getLeftColor(point position, int width, bitmap_image& provinceMap);
-commonItems::Color getRightColor(point position, int width, bitmap_image& provinceMap);
+namespace
+{
+
+const std::string mapDataCacheFile = "map_data.cache";
 
+// bump whenever the cache layout or the way MapData derives its contents changes
+constexpr uint32_t mapDataCacheVersion = 1;
+constexpr char mapDataCacheMagic[8] = {'V', '2', 'H', '4', 'M', 'A', 'P', 'S'};
 
-HoI4::MapData::MapData(const ProvinceDefinitions& provinceDefinitions, const Configuration& theConfiguration):
-	 provinceMap(theConfiguration.getHoI4Path() + "/map/provinces.bmp")
+
+template <typename T> void appendValue(std::string& buffer, const T value)
 {
-	if (!provinceMap)
+	buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+
+template <typename T> bool readValue(const std::string& buffer, size_t& position, T& value)
+{
+	if (buffer.size() - position < sizeof(value))
 	{
-		throw std::runtime_error("Could not open " + theConfiguration.getHoI4Path() + "/map/provinces.bmp");
+		return false;
 	}
+	std::memcpy(&value, &buffer[position], sizeof(value));
+	position += sizeof(value);
+	return true;
+}
+
+} // namespace
+
+
 
-	auto height = provinceMap.height();
-	auto width = provinceMap.width();
-	for (unsigned int y = 0; y < height; y++)
+std::optional<uint64_t> hashMapInputs(const std::string& HoI4Path);
+std::vector<std::pair<unsigned int, unsigned int>> divideIntoBands(unsigned int numRows,
+	 unsigned int requestedThreads);
+
+
+HoI4::MapData::MapData(const ProvinceDefinitions& provinceDefinitions, const Configuration& theConfiguration)
+{
+	const auto inputsHash =
+		 theConfiguration.getCacheMapData() ? hashMapInputs(theConfiguration.getHoI4Path()) : std::nullopt;
+	if (inputsHash && importCache(mapDataCacheFile, *inputsHash))
+	{
+		Log(LogLevel::Info) << "\tRead map data from " << mapDataCacheFile;
+	}
+	else
 	{
-		for (unsigned int x = 0; x < width; x++)
+		importMap(provinceDefinitions, theConfiguration);
+		if (inputsHash)
 		{
-			point position = {x, y};
+			exportCache(mapDataCacheFile, *inputsHash);
+		}
+	}
 
-			auto centerColor = getCenterColor(position, provinceMap);
-			auto aboveColor = getAboveColor(position, provinceMap);
-			auto belowColor = getBelowColor(position, height, provinceMap);
-			auto leftColor = getLeftColor(position, width, provinceMap);
-			auto rightColor = getRightColor(position, width, provinceMap);
+	findProvinceCenters();
+}
 
-			position.second = height - position.second - 1;
-			if (centerColor != aboveColor)
-			{
-				handleNeighbor(centerColor, aboveColor, position, provinceDefinitions);
-			}
-			if (centerColor != rightColor)
-			{
-				handleNeighbor(centerColor, rightColor, position, provinceDefinitions);
-			}
-			if (centerColor != belowColor)
-			{
-				handleNeighbor(centerColor, belowColor, position, provinceDefinitions);
-			}
-			if (centerColor != leftColor)
+
+// FNV-1a over the contents and sizes of provinces.bmp and definition.csv, or nothing if either can't be read, as a
+// cache keyed on missing inputs could be reused after they reappear with different contents
+std::optional<uint64_t> hashMapInputs(const std::string& HoI4Path)
+{
+	constexpr uint64_t prime = 1099511628211ULL;
+	uint64_t hash = 14695981039346656037ULL;
+	const auto addByte = [&hash](const unsigned char byte) {
+		hash ^= byte;
+		hash *= prime;
+	};
+
+	std::vector<char> buffer(1 << 16);
+	for (const auto& filename: {HoI4Path + "/map/provinces.bmp", HoI4Path + "/map/definition.csv"})
+	{
+		std::ifstream file(filename, std::ios::binary);
+		if (!file.is_open())
+		{
+			Log(LogLevel::Warning) << "Could not read " << filename << ", so map data will not be cached";
+			return std::nullopt;
+		}
+
+		uint64_t size = 0;
+		while (file.read(buffer.data(), static_cast<std::streamsize>(buffer.size())) || (file.gcount() > 0))
+		{
+			const auto bytesRead = static_cast<size_t>(file.gcount());
+			for (size_t i = 0; i < bytesRead; i++)
 			{
-				handleNeighbor(centerColor, leftColor, position, provinceDefinitions);
+				addByte(static_cast<unsigned char>(buffer[i]));
 			}
+			size += bytesRead;
+		}
+		if (file.bad())
+		{
+			Log(LogLevel::Warning) << "Could not read " << filename << ", so map data will not be cached";
+			return std::nullopt;
+		}
+		for (auto shift = 0; shift < 64; shift += 8)
+		{
+			addByte(static_cast<unsigned char>(size >> shift));
+		}
+	}
+
+	return hash;
+}
+
+
+void HoI4::MapData::importMap(const ProvinceDefinitions& provinceDefinitions, const Configuration& theConfiguration)
+{
+	bitmap_image provinceMap(theConfiguration.getHoI4Path() + "/map/provinces.bmp");
+	if (!provinceMap)
+	{
+		throw std::runtime_error("Could not open " + theConfiguration.getHoI4Path() + "/map/provinces.bmp");
+	}
+
+	mapWidth = provinceMap.width();
+	mapHeight = provinceMap.height();
+	provinceRaster.resize(static_cast<size_t>(mapWidth) * mapHeight, 0);
+
+	// Each band of rows is read and scanned independently, then the results are merged from the top of the map down.
+	// That is the order a single pass would have found everything in, so the output does not depend on thread count.
+	const auto bands = divideIntoBands(mapHeight, theConfiguration.getNumberOfThreads());
+	forEachInParallel(bands.size(), static_cast<unsigned int>(bands.size()), [&](const size_t band) {
+		readProvinceRaster(provinceMap, provinceDefinitions, bands[band].first, bands[band].second);
+	});
+
+	std::vector<ScanResults> results(bands.size());
+	forEachInParallel(bands.size(), static_cast<unsigned int>(bands.size()), [&](const size_t band) {
+		scanRows(bands[band].first, bands[band].second, results[band]);
+	});
+	std::map<int, bordersWith> borders;
+	for (auto& bandResults: results)
+	{
+		mergeScanResults(bandResults, borders);
+	}
+	findBorderCenters(borders);
+}
+
+
+std::vector<std::pair<unsigned int, unsigned int>> divideIntoBands(const unsigned int numRows,
+	 const unsigned int requestedThreads)
+{
+	auto numBands = (requestedThreads > 0) ? requestedThreads : std::thread::hardware_concurrency();
+	numBands = std::clamp(numBands, 1U, std::max(numRows, 1U));
+
+	std::vector<std::pair<unsigned int, unsigned int>> bands;
+	for (unsigned int band = 0; band < numBands; band++)
+	{
+		bands.emplace_back(static_cast<unsigned int>(static_cast<size_t>(numRows) * band / numBands),
+			 static_cast<unsigned int>(static_cast<size_t>(numRows) * (band + 1) / numBands));
+	}
+	return bands;
+}
+
 
-			auto province = provinceDefinitions.getProvinceFromColor(centerColor);
-			if (province)
+void HoI4::MapData::readProvinceRaster(const bitmap_image& provinceMap,
+	 const ProvinceDefinitions& provinceDefinitions,
+	 const unsigned int firstRow,
+	 const unsigned int endRow)
+{
+	// provinces are mostly long runs of one color, so only look up a color when it changes
+	auto lastColor = -1;
+	auto lastProvince = 0;
+
+	const auto bytesPerPixel = provinceMap.bytes_per_pixel();
+	for (auto y = firstRow; y < endRow; y++)
+	{
+		const auto* pixel = provinceMap.row(y);
+		auto* rasterRow = &provinceRaster[static_cast<size_t>(mapHeight - y - 1) * mapWidth];
+		for (unsigned int x = 0; x < mapWidth; x++, pixel += bytesPerPixel)
+		{
+			const int blue = pixel[0];
+			const int green = pixel[1];
+			const int red = pixel[2];
+			if (const auto color = (red << 16) | (green << 8) | blue; color != lastColor)
 			{
-				auto specificProvincePoints = theProvincePoints.find(*province);
-				if (specificProvincePoints != theProvincePoints.end())
-				{
-					specificProvincePoints->second.addPoint(position);
-				}
-				else
-				{
-					ProvincePoints theNewPoints;
-					theNewPoints.addPoint(position);
-					theProvincePoints.insert(std::make_pair(*province, theNewPoints));
-				}
+				lastColor = color;
+				lastProvince = provinceDefinitions.getProvinceFromColor(red, green, blue).value_or(0);
 			}
+			rasterRow[x] = lastProvince;
 		}
 	}
 }
 
 
-commonItems::Color getCenterColor(const point position, bitmap_image& provinceMap)
+void HoI4::MapData::scanRows(const unsigned int firstRow, const unsigned int endRow, ScanResults& results) const
+{
+	std::vector<unsigned char> isBorder(mapWidth);
+	for (auto y = firstRow; y < endRow; y++)
+	{
+		scanRow(y, isBorder, results);
+	}
+}
+
+
+// Flags each pixel that differs from any of its four neighbors. The interior is kept branch-free so the compiler can
+// vectorize it; the edges wrap around horizontally.
+void markBorderPixels(const int* above,
+	 const int* center,
+	 const int* below,
+	 const unsigned int width,
+	 std::vector<unsigned char>& isBorder)
 {
-	rgb_t color{0, 0, 0};
-	provinceMap.get_pixel(position.first, position.second, color);
+	const auto markPixel = [&](const unsigned int x, const unsigned int left, const unsigned int right) {
+		isBorder[x] = (center[x] != above[x]) | (center[x] != below[x]) | (center[x] != center[left]) |
+						  (center[x] != center[right]);
+	};
 
-	return commonItems::Color(std::array<int, 3>{color.red, color.green, color.blue});
+	for (unsigned int x = 1; x + 1 < width; x++)
+	{
+		isBorder[x] = (center[x] != above[x]) | (center[x] != below[x]) | (center[x] != center[x - 1]) |
+						  (center[x] != center[x + 1]);
+	}
+	markPixel(0, width - 1, (width > 1) ? 1 : 0);
+	markPixel(width - 1, (width > 1) ? width - 2 : 0, 0);
+}
+
+
+void HoI4::MapData::scanRow(const unsigned int y,
+	 std::vector<unsigned char>& isBorder,
+	 ScanResults& results) const
+{
+	// y counts down from the top of the bitmap, while the raster and all stored points count up from the bottom
+	const auto row = static_cast<int>(mapHeight - y - 1);
+	const auto* center = &provinceRaster[static_cast<size_t>(row) * mapWidth];
+	const auto* above = (y > 0) ? center + mapWidth : center;
+	const auto* below = (y < mapHeight - 1) ? center - mapWidth : center;
+
+	markBorderPixels(above, center, below, mapWidth, isBorder);
+	for (unsigned int x = 0; x < mapWidth; x++)
+	{
+		if (!isBorder[x])
+		{
+			continue;
+		}
+
+		const point position = {x, row};
+		const auto right = (x < mapWidth - 1) ? x + 1 : 0;
+		const auto left = (x > 0) ? x - 1 : mapWidth - 1;
+		if (center[x] != above[x])
+		{
+			results.handleNeighbor(center[x], above[x], position);
+		}
+		if (center[x] != center[right])
+		{
+			results.handleNeighbor(center[x], center[right], position);
+		}
+		if (center[x] != below[x])
+		{
+			results.handleNeighbor(center[x], below[x], position);
+		}
+		if (center[x] != center[left])
+		{
+			results.handleNeighbor(center[x], center[left], position);
+		}
+	}
+
+	for (unsigned int x = 0; x < mapWidth;)
+	{
+		auto runEnd = x;
+		while ((runEnd + 1 < mapWidth) && (center[runEnd + 1] == center[x]))
+		{
+			runEnd++;
+		}
+		if (center[x] != 0)
+		{
+			results.theProvincePoints[center[x]].addSpan(row, static_cast<int>(x), static_cast<int>(runEnd));
+		}
+		x = runEnd + 1;
+	}
 }
 
 
-commonItems::Color getAboveColor(point position, bitmap_image& provinceMap)
+void HoI4::MapData::mergeScanResults(ScanResults& results, std::map<int, bordersWith>& borders)
 {
-	if (position.second > 0)
+	for (auto& [province, neighbors]: results.provinceNeighbors)
 	{
-		position.second--;
+		provinceNeighbors[province].merge(neighbors);
 	}
 
-	rgb_t color{0, 0, 0};
-	provinceMap.get_pixel(position.first, position.second, color);
+	for (const auto& [province, bordersWithNeighbors]: results.borders)
+	{
+		auto& mergedBordersWithNeighbors = borders[province];
+		for (const auto& [neighbor, points]: bordersWithNeighbors)
+		{
+			auto& mergedPoints = mergedBordersWithNeighbors[neighbor];
+			mergedPoints.insert(mergedPoints.end(), points.begin(), points.end());
+		}
+	}
 
-	return commonItems::Color(std::array<int, 3>{color.red, color.green, color.blue});
+	for (const auto& [province, points]: results.theProvincePoints)
+	{
+		theProvincePoints[province].addPoints(points);
+	}
 }
 
 
-commonItems::Color getBelowColor(point position, const int height, bitmap_image& provinceMap)
+void HoI4::MapData::findBorderCenters(const std::map<int, bordersWith>& borders)
 {
-	if (position.second < height - 1)
+	for (const auto& [province, bordersWithNeighbors]: borders)
 	{
-		position.second++;
+		auto& centers = borderCenters[province];
+		for (const auto& [neighbor, points]: bordersWithNeighbors)
+		{
+			centers.emplace(neighbor, points[points.size() / 2]);
+		}
 	}
+}
 
-	rgb_t color{0, 0, 0};
-	provinceMap.get_pixel(position.first, position.second, color);
 
-	return commonItems::Color(std::array<int, 3>{color.red, color.green, color.blue});
+void HoI4::MapData::findProvinceCenters()
+{
+	for (const auto& [province, points]: theProvincePoints)
+	{
+		provinceCenters.emplace_hint(provinceCenters.end(), province, points.getCentermostPoint());
+	}
 }
 
 
-commonItems::Color getLeftColor(point position, const int width, bitmap_image& provinceMap)
+// The cache is read in a single pass over one buffer. It is native-endian, as it only ever lives next to the converter
+// that wrote it. Anything unexpected in it means it is stale or damaged, so the map is simply imported again.
+bool HoI4::MapData::importCache(const std::string& cacheFile, const uint64_t inputsHash)
 {
-	if (position.first > 0)
+	std::ifstream cache(cacheFile, std::ios::binary | std::ios::ate);
+	if (!cache.is_open())
 	{
-		position.first--;
+		return false;
 	}
-	else
+	std::string buffer(static_cast<size_t>(cache.tellg()), '\0');
+	cache.seekg(0);
+	if (!cache.read(buffer.data(), static_cast<std::streamsize>(buffer.size())))
 	{
-		position.first = width - 1;
+		return false;
+	}
+
+	size_t position = 0;
+	char magic[sizeof(mapDataCacheMagic)];
+	uint32_t version;
+	uint64_t hash;
+	uint32_t width;
+	uint32_t height;
+	if (!readValue(buffer, position, magic) || (std::memcmp(magic, mapDataCacheMagic, sizeof(magic)) != 0) ||
+		 !readValue(buffer, position, version) || (version != mapDataCacheVersion) ||
+		 !readValue(buffer, position, hash) || (hash != inputsHash) || !readValue(buffer, position, width) ||
+		 !readValue(buffer, position, height))
+	{
+		return false;
+	}
+
+	std::map<int, std::set<int>> cachedNeighbors;
+	uint32_t numProvinces;
+	if (!readValue(buffer, position, numProvinces))
+	{
+		return false;
+	}
+	for (uint32_t i = 0; i < numProvinces; i++)
+	{
+		int32_t province;
+		uint32_t numNeighbors;
+		if (!readValue(buffer, position, province) || !readValue(buffer, position, numNeighbors))
+		{
+			return false;
+		}
+		auto& neighbors = cachedNeighbors[province];
+		for (uint32_t j = 0; j < numNeighbors; j++)
+		{
+			int32_t neighbor;
+			if (!readValue(buffer, position, neighbor))
+			{
+				return false;
+			}
+			neighbors.insert(neighbor);
+		}
+	}
+
+	std::map<int, std::map<int, point>> cachedBorderCenters;
+	if (!readValue(buffer, position, numProvinces))
+	{
+		return false;
+	}
+	for (uint32_t i = 0; i < numProvinces; i++)
+	{
+		int32_t province;
+		uint32_t numNeighbors;
+		if (!readValue(buffer, position, province) || !readValue(buffer, position, numNeighbors))
+		{
+			return false;
+		}
+		auto& centers = cachedBorderCenters[province];
+		for (uint32_t j = 0; j < numNeighbors; j++)
+		{
+			int32_t neighbor;
+			int32_t x;
+			int32_t y;
+			if (!readValue(buffer, position, neighbor) || !readValue(buffer, position, x) ||
+				 !readValue(buffer, position, y))
+			{
+				return false;
+			}
+			centers.emplace(neighbor, point{x, y});
+		}
+	}
+
+	std::map<int, ProvincePoints> cachedProvincePoints;
+	if (!readValue(buffer, position, numProvinces))
+	{
+		return false;
+	}
+	for (uint32_t i = 0; i < numProvinces; i++)
+	{
+		int32_t province;
+		uint32_t numSpans;
+		if (!readValue(buffer, position, province) || !readValue(buffer, position, numSpans))
+		{
+			return false;
+		}
+		auto& points = cachedProvincePoints[province];
+		for (uint32_t j = 0; j < numSpans; j++)
+		{
+			int32_t y;
+			int32_t leftX;
+			int32_t rightX;
+			if (!readValue(buffer, position, y) || !readValue(buffer, position, leftX) ||
+				 !readValue(buffer, position, rightX))
+			{
+				return false;
+			}
+			if ((y < 0) || (static_cast<uint32_t>(y) >= height) || (leftX < 0) || (leftX > rightX) ||
+				 (static_cast<uint32_t>(rightX) >= width))
+			{
+				return false;
+			}
+			points.addSpan(y, leftX, rightX);
+		}
 	}
 
-	rgb_t color{0, 0, 0};
-	provinceMap.get_pixel(position.first, position.second, color);
+	if (position != buffer.size())
+	{
+		return false;
+	}
 
-	return commonItems::Color(std::array<int, 3>{color.red, color.green, color.blue});
+	mapWidth = width;
+	mapHeight = height;
+	provinceNeighbors = std::move(cachedNeighbors);
+	borderCenters = std::move(cachedBorderCenters);
+	theProvincePoints = std::move(cachedProvincePoints);
+	fillRasterFromPoints();
+	return true;
 }
 
 
-commonItems::Color getRightColor(point position, const int width, bitmap_image& provinceMap)
+void HoI4::MapData::exportCache(const std::string& cacheFile, const uint64_t inputsHash) const
 {
-	if (position.first < width - 1)
+	std::string buffer;
+	buffer.append(mapDataCacheMagic, sizeof(mapDataCacheMagic));
+	appendValue(buffer, mapDataCacheVersion);
+	appendValue(buffer, inputsHash);
+	appendValue(buffer, static_cast<uint32_t>(mapWidth));
+	appendValue(buffer, static_cast<uint32_t>(mapHeight));
+
+	appendValue(buffer, static_cast<uint32_t>(provinceNeighbors.size()));
+	for (const auto& [province, neighbors]: provinceNeighbors)
 	{
-		position.first++;
+		appendValue(buffer, static_cast<int32_t>(province));
+		appendValue(buffer, static_cast<uint32_t>(neighbors.size()));
+		for (const auto neighbor: neighbors)
+		{
+			appendValue(buffer, static_cast<int32_t>(neighbor));
+		}
 	}
-	else
+
+	appendValue(buffer, static_cast<uint32_t>(borderCenters.size()));
+	for (const auto& [province, centers]: borderCenters)
 	{
-		position.first = 0;
+		appendValue(buffer, static_cast<int32_t>(province));
+		appendValue(buffer, static_cast<uint32_t>(centers.size()));
+		for (const auto& [neighbor, center]: centers)
+		{
+			appendValue(buffer, static_cast<int32_t>(neighbor));
+			appendValue(buffer, static_cast<int32_t>(center.first));
+			appendValue(buffer, static_cast<int32_t>(center.second));
+		}
 	}
 
-	rgb_t color{0, 0, 0};
-	provinceMap.get_pixel(position.first, position.second, color);
+	appendValue(buffer, static_cast<uint32_t>(theProvincePoints.size()));
+	for (const auto& [province, points]: theProvincePoints)
+	{
+		appendValue(buffer, static_cast<int32_t>(province));
+		appendValue(buffer, static_cast<uint32_t>(points.getSpans().size()));
+		for (const auto& span: points.getSpans())
+		{
+			appendValue(buffer, static_cast<int32_t>(span.y));
+			appendValue(buffer, static_cast<int32_t>(span.leftX));
+			appendValue(buffer, static_cast<int32_t>(span.rightX));
+		}
+	}
+
+	// Written under a name of its own and then renamed over the old cache, so an interrupted write or another conversion
+	// writing at the same time never leaves a partly written cache behind.
+	const auto partialFile = cacheFile + "." + std::to_string(std::mt19937_64{std::random_device{}()}()) + ".partial";
+	std::ofstream cache(partialFile, std::ios::binary | std::ios::trunc);
+	cache.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+	cache.close();
+	if (!cache)
+	{
+		Log(LogLevel::Warning) << "Could not write map data to " << cacheFile;
+		std::remove(partialFile.c_str());
+		return;
+	}
 
-	return commonItems::Color(std::array<int, 3>{color.red, color.green, color.blue});
+	// renaming onto an existing file fails on Windows, so there the old cache is removed and the rename tried again
+	if (std::rename(partialFile.c_str(), cacheFile.c_str()) != 0)
+	{
+		std::remove(cacheFile.c_str());
+		if (std::rename(partialFile.c_str(), cacheFile.c_str()) != 0)
+		{
+			Log(LogLevel::Warning) << "Could not write map data to " << cacheFile;
+			std::remove(partialFile.c_str());
+		}
+	}
 }
 
 
-void HoI4::MapData::handleNeighbor(const commonItems::Color& centerColor,
-	 const commonItems::Color& otherColor,
-	 const point& position,
-	 const ProvinceDefinitions& provinceDefinitions)
+void HoI4::MapData::fillRasterFromPoints()
 {
-	auto centerProvince = provinceDefinitions.getProvinceFromColor(centerColor);
-	auto otherProvince = provinceDefinitions.getProvinceFromColor(otherColor);
-	if (centerProvince && otherProvince)
+	provinceRaster.assign(static_cast<size_t>(mapWidth) * mapHeight, 0);
+	for (const auto& [province, points]: theProvincePoints)
 	{
-		addNeighbor(*centerProvince, *otherProvince);
-		addPointToBorder(*centerProvince, *otherProvince, position);
+		for (const auto& span: points.getSpans())
+		{
+			std::fill_n(provinceRaster.begin() + static_cast<ptrdiff_t>(span.y) * mapWidth + span.leftX,
+				 span.rightX - span.leftX + 1,
+				 province);
+		}
 	}
 }
 
 
-void HoI4::MapData::addNeighbor(const int mainProvince, const int neighborProvince)
+void HoI4::MapData::ScanResults::handleNeighbor(const int centerProvince,
+	 const int otherProvince,
+	 const point& position)
+{
+	if ((centerProvince != 0) && (otherProvince != 0))
+	{
+		addNeighbor(centerProvince, otherProvince);
+		addPointToBorder(centerProvince, otherProvince, position);
+	}
+}
+
+
+void HoI4::MapData::ScanResults::addNeighbor(const int mainProvince, const int neighborProvince)
 {
 	if (auto centerMapping = provinceNeighbors.find(mainProvince); centerMapping != provinceNeighbors.end())
 	{
@@ -175,7 +575,7 @@ void HoI4::MapData::addNeighbor(const int mainProvince, const int neighborProvin
 }
 
 
-void HoI4::MapData::addPointToBorder(int mainProvince, int neighborProvince, const point position)
+void HoI4::MapData::ScanResults::addPointToBorder(int mainProvince, int neighborProvince, const point position)
 {
 	auto bordersWithNeighbors = borders.find(mainProvince);
 	if (bordersWithNeighbors == borders.end())
@@ -208,7 +608,7 @@ void HoI4::MapData::addPointToBorder(int mainProvince, int neighborProvince, con
 }
 
 
-std::set<int> HoI4::MapData::getNeighbors(const int province) const
+const std::set<int>& HoI4::MapData::getNeighbors(const int province) const
 {
 	if (const auto neighbors = provinceNeighbors.find(province); neighbors != provinceNeighbors.end())
 	{
@@ -216,7 +616,7 @@ std::set<int> HoI4::MapData::getNeighbors(const int province) const
 	}
 	else
 	{
-		std::set<int> empty;
+		static const std::set<int> empty;
 		return empty;
 	}
 }
@@ -224,62 +624,80 @@ std::set<int> HoI4::MapData::getNeighbors(const int province) const
 
 std::optional<point> HoI4::MapData::getSpecifiedBorderCenter(const int mainProvince, const int neighbor) const
 {
-	const auto bordersWithNeighbors = borders.find(mainProvince);
-	if (bordersWithNeighbors == borders.end())
+	const auto centers = borderCenters.find(mainProvince);
+	if (centers == borderCenters.end())
 	{
 		Log(LogLevel::Warning) << "Province " << mainProvince << " has no borders.";
 		return std::nullopt;
 	}
 
-	const auto border = bordersWithNeighbors->second.find(neighbor);
-	if (border == bordersWithNeighbors->second.end())
+	const auto center = centers->second.find(neighbor);
+	if (center == centers->second.end())
 	{
 		Log(LogLevel::Warning) << "Province " << mainProvince << " does not border " << neighbor << ".";
 		return std::nullopt;
 	}
 
-	return border->second[(border->second.size() / 2)];
+	return center->second;
 }
 
 
 std::optional<point> HoI4::MapData::getAnyBorderCenter(const int province) const
 {
-	const auto bordersWithNeighbors = borders.find(province);
-	if (bordersWithNeighbors == borders.end())
+	const auto centers = borderCenters.find(province);
+	if (centers == borderCenters.end())
 	{
 		Log(LogLevel::Warning) << "Province " << province << " has no borders.";
 		return std::nullopt;
 	}
 
-	const auto border = bordersWithNeighbors->second.begin();
-	if (border == bordersWithNeighbors->second.end())
+	const auto center = centers->second.begin();
+	if (center == centers->second.end())
 	{
 		Log(LogLevel::Warning) << "Province " << province << " has no borders.";
 		return std::nullopt;
 	}
 
-	return border->second[(border->second.size() / 2)];
+	return center->second;
 }
 
 
-std::optional<int> HoI4::MapData::getProvinceNumber(const double x,
-	 const double y,
-	 const ProvinceDefinitions& provinceDefinitions) const
+std::optional<int> HoI4::MapData::getProvinceNumber(const double x, const double y) const
 {
-	rgb_t color{0, 0, 0};
-	provinceMap.get_pixel(static_cast<unsigned int>(x),
-		 (provinceMap.height() - 1) - static_cast<unsigned int>(y),
-		 color);
-	return provinceDefinitions.getProvinceFromColor(
-		 commonItems::Color(std::array<int, 3>{color.red, color.green, color.blue}));
+	const auto column = static_cast<unsigned int>(x);
+	const auto row = static_cast<unsigned int>(y);
+	if ((column >= mapWidth) || (row >= mapHeight))
+	{
+		return std::nullopt;
+	}
+
+	const auto province = provinceRaster[static_cast<size_t>(row) * mapWidth + column];
+	if (province == 0)
+	{
+		return std::nullopt;
+	}
+	return province;
 }
 
 
-std::optional<HoI4::ProvincePoints> HoI4::MapData::getProvincePoints(const int provinceNum) const
+const HoI4::ProvincePoints* HoI4::MapData::getProvincePoints(const int provinceNum) const
 {
 	if (const auto possiblePoints = theProvincePoints.find(provinceNum); possiblePoints != theProvincePoints.end())
 	{
-		return possiblePoints->second;
+		return &possiblePoints->second;
+	}
+	else
+	{
+		return nullptr;
+	}
+}
+
+
+std::optional<point> HoI4::MapData::getProvinceCenter(const int provinceNum) const
+{
+	if (const auto center = provinceCenters.find(provinceNum); center != provinceCenters.end())
+	{
+		return center->second;
 	}
 	else
 	{
@@ -7,10 +7,16 @@
 #include "Configuration.h"
 #include "HOI4World/ProvinceDefinitions.h"
 #include "ProvincePoints.h"
-#include "bitmap_image.hpp"
+#include <cstdint>
 #include <map>
 #include <optional>
 #include <set>
+#include <string>
+#include <vector>
+
+
+
+class bitmap_image;
 
 
 
@@ -27,28 +33,53 @@ class MapData
   public:
 	MapData(const ProvinceDefinitions& provinceDefinitions, const Configuration& theConfiguration);
 
-	[[nodiscard]] std::set<int> getNeighbors(int province) const;
+	// empty if the province has no neighbors
+	[[nodiscard]] const std::set<int>& getNeighbors(int province) const;
 	[[nodiscard]] std::optional<point> getSpecifiedBorderCenter(int mainProvince, int neighbor) const;
 	[[nodiscard]] std::optional<point> getAnyBorderCenter(int province) const;
-	[[nodiscard]] std::optional<int> getProvinceNumber(double x,
-		 double y,
-		 const ProvinceDefinitions& provinceDefinitions) const;
+	[[nodiscard]] std::optional<int> getProvinceNumber(double x, double y) const;
 
-	[[nodiscard]] std::optional<ProvincePoints> getProvincePoints(int provinceNum) const;
+	// nullptr if the province is not on the map
+	[[nodiscard]] const ProvincePoints* getProvincePoints(int provinceNum) const;
+	[[nodiscard]] std::optional<point> getProvinceCenter(int provinceNum) const;
 
   private:
-	void handleNeighbor(const commonItems::Color& centerColor,
-		 const commonItems::Color& otherColor,
-		 const point& position,
-		 const ProvinceDefinitions& provinceDefinitions);
-	void addNeighbor(int mainProvince, int neighborProvince);
-	void addPointToBorder(int mainProvince, int neighborProvince, point position);
+	// the neighbors, borders, and points found in one band of rows of the map
+	struct ScanResults
+	{
+		void handleNeighbor(int centerProvince, int otherProvince, const point& position);
+		void addNeighbor(int mainProvince, int neighborProvince);
+		void addPointToBorder(int mainProvince, int neighborProvince, point position);
+
+		std::map<int, std::set<int>> provinceNeighbors;
+		std::map<int, bordersWith> borders;
+		std::map<int, ProvincePoints> theProvincePoints;
+	};
+
+	void importMap(const ProvinceDefinitions& provinceDefinitions, const Configuration& theConfiguration);
+	void readProvinceRaster(const bitmap_image& provinceMap,
+		 const ProvinceDefinitions& provinceDefinitions,
+		 unsigned int firstRow,
+		 unsigned int endRow);
+	void scanRows(unsigned int firstRow, unsigned int endRow, ScanResults& results) const;
+	void scanRow(unsigned int y, std::vector<unsigned char>& isBorder, ScanResults& results) const;
+	void mergeScanResults(ScanResults& results, std::map<int, bordersWith>& borders);
+	void findBorderCenters(const std::map<int, bordersWith>& borders);
+	void findProvinceCenters();
+
+	bool importCache(const std::string& cacheFile, uint64_t inputsHash);
+	void exportCache(const std::string& cacheFile, uint64_t inputsHash) const;
+	void fillRasterFromPoints();
 
 	std::map<int, std::set<int>> provinceNeighbors;
-	std::map<int, bordersWith> borders;
+	std::map<int, std::map<int, point>> borderCenters;
 	std::map<int, ProvincePoints> theProvincePoints;
+	std::map<int, point> provinceCenters; // the centermost point of each province, found once after loading
 
-	bitmap_image provinceMap;
+	// province number of every pixel, bottom row first. 0 where the color matched no province
+	std::vector<int> provinceRaster;
+	unsigned int mapWidth = 0;
+	unsigned int mapHeight = 0;
 };
 
 } // namespace HoI4
@@ -1,64 +1,157 @@
 #include "ProvincePoints.h"
+#include <algorithm>
+#include <limits>
+#include <iterator>
 #include <numeric>
 
 
 
 void HoI4::ProvincePoints::addPoint(const point& thePoint)
 {
-	thePoints.emplace(thePoint);
-	if (thePoint.first < leftmostPoint.first)
+	addSpan(thePoint.second, thePoint.first, thePoint.first);
+}
+
+
+void HoI4::ProvincePoints::addSpan(const int y, const int leftX, const int rightX)
+{
+	if (!spans.empty())
 	{
-		leftmostPoint = thePoint;
+		rowsAscend = rowsAscend && (spans.back().y <= y);
+		rowsDescend = rowsDescend && (spans.back().y >= y);
 	}
-	if (thePoint.first > rightmostPoint.first)
+
+	if (!spans.empty() && (spans.back().y == y) && (spans.back().rightX + 1 == leftX))
 	{
-		rightmostPoint = thePoint;
+		spans.back().rightX = rightX;
 	}
-	if (thePoint.second < lowestPoint.second)
+	else
 	{
-		lowestPoint = thePoint;
+		spans.push_back(Span{y, leftX, rightX});
 	}
-	if (thePoint.second > highestPoint.second)
+
+	leftmostX = std::min(leftmostX, leftX);
+	rightmostX = std::max(rightmostX, rightX);
+	lowestY = std::min(lowestY, y);
+	highestY = std::max(highestY, y);
+}
+
+
+void HoI4::ProvincePoints::addPoints(const ProvincePoints& otherPoints)
+{
+	for (const auto& span: otherPoints.spans)
 	{
-		highestPoint = thePoint;
+		addSpan(span.y, span.leftX, span.rightX);
 	}
 }
 
 
-double calculateDistanceSquared(int pointX, int pointY, int centerX, int centerY);
+namespace
+{
+
+// the squared distance to target from the point of span nearest it, which is the one nearest it horizontally
+long long calculateDistanceSquared(const HoI4::ProvincePoints::Span& span, const point& target, point& nearestPoint)
+{
+	nearestPoint = {std::clamp(target.first, span.leftX, span.rightX), span.y};
+	const auto deltaX = static_cast<long long>(nearestPoint.first) - target.first;
+	const auto deltaY = static_cast<long long>(nearestPoint.second) - target.second;
+	return deltaX * deltaX + deltaY * deltaY;
+}
+
+
+// Keeps the nearest point seen so far. Ties are broken towards the lowest point, matching the order the points would
+// be visited in if they were sorted, so the result does not depend on the order spans are looked at.
+class NearestPoint
+{
+  public:
+	void consider(const HoI4::ProvincePoints::Span& span, const point& target)
+	{
+		point possiblePoint;
+		const auto distanceSquared = calculateDistanceSquared(span, target, possiblePoint);
+		if ((distanceSquared < shortestDistance) ||
+			 ((distanceSquared == shortestDistance) && (possiblePoint < closestPoint)))
+		{
+			shortestDistance = distanceSquared;
+			closestPoint = possiblePoint;
+		}
+	}
+
+	[[nodiscard]] long long getDistanceSquared() const { return shortestDistance; }
+	[[nodiscard]] const point& getPoint() const { return closestPoint; }
+
+  private:
+	long long shortestDistance = std::numeric_limits<long long>::max();
+	point closestPoint;
+};
+
+} // namespace
+
+
+
 point HoI4::ProvincePoints::getCentermostPoint() const
 {
-	point possibleCenter;
-	possibleCenter.first = std::midpoint(leftmostPoint.first, rightmostPoint.first);
-	possibleCenter.second = std::midpoint(lowestPoint.second, highestPoint.second);
-	if (thePoints.contains(possibleCenter))
+	if (spans.empty())
 	{
-		return possibleCenter;
+		return {0, 0};
 	}
-	else
+
+	// the point nearest the middle of the bounding box, which is the middle itself if the province covers it
+	const point center{std::midpoint(leftmostX, rightmostX), std::midpoint(lowestY, highestY)};
+	if (rowsAscend || rowsDescend)
+	{
+		return findNearestPointInRows(center);
+	}
+	return findNearestPointInAllSpans(center);
+}
+
+
+// Starts at the target's row and works outwards a row at a time, stopping once the rows are further away vertically
+// than the nearest point found. For a province that covers its center that is only the center row.
+point HoI4::ProvincePoints::findNearestPointInRows(const point& target) const
+{
+	const auto rowDistanceSquared = [&target](const Span& span) {
+		const auto deltaY = static_cast<long long>(span.y) - target.second;
+		return deltaY * deltaY;
+	};
+
+	auto after = std::partition_point(spans.begin(), spans.end(), [this, &target](const Span& span) {
+		return rowsAscend ? (span.y < target.second) : (span.y > target.second);
+	});
+	auto before = after;
+
+	NearestPoint nearest;
+	while (true)
 	{
-		auto shortestDistance = std::numeric_limits<double>::max();
-		point closestPoint;
-		for (const auto& possiblePoint: thePoints)
+		const auto afterIsInRange =
+			 (after != spans.end()) && (rowDistanceSquared(*after) <= nearest.getDistanceSquared());
+		const auto beforeIsInRange =
+			 (before != spans.begin()) && (rowDistanceSquared(*std::prev(before)) <= nearest.getDistanceSquared());
+		if (!afterIsInRange && !beforeIsInRange)
+		{
+			break;
+		}
+
+		if (afterIsInRange && (!beforeIsInRange || rowDistanceSquared(*after) <= rowDistanceSquared(*std::prev(before))))
 		{
-			const auto distanceSquared = calculateDistanceSquared(possiblePoint.first,
-				 possiblePoint.second,
-				 possibleCenter.first,
-				 possibleCenter.second);
-			if (distanceSquared < shortestDistance)
-			{
-				shortestDistance = distanceSquared;
-				closestPoint = possiblePoint;
-			}
+			nearest.consider(*after, target);
+			++after;
+		}
+		else
+		{
+			--before;
+			nearest.consider(*before, target);
 		}
-		return closestPoint;
 	}
+
+	return nearest.getPoint();
 }
 
 
-double calculateDistanceSquared(const int pointX, const int pointY, const int centerX, const int centerY)
+point HoI4::ProvincePoints::findNearestPointInAllSpans(const point& target) const
 {
-	const auto deltaX = static_cast<double>(pointX) - static_cast<double>(centerX);
-	const auto deltaY = static_cast<double>(pointY) - static_cast<double>(centerY);
-	return deltaX * deltaX + deltaY * deltaY;
+	NearestPoint nearest;
+	for (const auto& span: spans)
+	{
+		nearest.consider(span, target);
+	}
+	return nearest.getPoint();
 }
\ No newline at end of file
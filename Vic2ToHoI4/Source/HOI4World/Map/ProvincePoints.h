@@ -4,7 +4,7 @@
 
 
 #include <climits>
-#include <set>
+#include <vector>
 
 
 
@@ -18,16 +18,36 @@ namespace HoI4
 class ProvincePoints
 {
 	public:
+		// a horizontal run of points, from leftX to rightX inclusive
+		struct Span
+		{
+			int y;
+			int leftX;
+			int rightX;
+		};
+
 		void addPoint(const point& thePoint);
+		void addSpan(int y, int leftX, int rightX);
+		void addPoints(const ProvincePoints& otherPoints);
 
+		[[nodiscard]] const auto& getSpans() const { return spans; }
 		[[nodiscard]] point getCentermostPoint() const;
 
 	private:
-		std::set<point> thePoints;
-		point leftmostPoint = { INT_MAX, 0 };
-		point rightmostPoint = { -1, 0 };
-		point highestPoint = { 0, -1 };
-		point lowestPoint = { 0, INT_MAX };
+		[[nodiscard]] point findNearestPointInRows(const point& target) const;
+		[[nodiscard]] point findNearestPointInAllSpans(const point& target) const;
+
+		std::vector<Span> spans;
+		int leftmostX = INT_MAX;
+		int rightmostX = -1;
+		int highestY = -1;
+		int lowestY = INT_MAX;
+
+		// whether each span is on the same row as the one before it or further in one direction, which lets the
+		// centermost point be found by searching outwards from the center row. Maps are scanned row by row, so
+		// provinces read from them always are.
+		bool rowsAscend = true;
+		bool rowsDescend = true;
 };
 
 }
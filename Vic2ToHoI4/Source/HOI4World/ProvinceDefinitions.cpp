@@ -4,11 +4,17 @@
 
 
 
+int getIntFromColor(const int red, const int green, const int blue)
+{
+	return ((red & 0xFF) << 16) + ((green & 0xFF) << 8) + (blue & 0xFF);
+}
+
+
 int getIntFromColor(const commonItems::Color& color)
 {
 	auto [r, g, b] = color.getRgbComponents();
 
-	return ((r & 0xFF) << 16) + ((g & 0xFF) << 8) + (b & 0xFF);
+	return getIntFromColor(r, g, b);
 }
 
 
@@ -74,7 +80,15 @@ HoI4::ProvinceDefinitions HoI4::ProvinceDefinitions::Importer::importProvinceDef
 
 std::optional<int> HoI4::ProvinceDefinitions::getProvinceFromColor(const commonItems::Color& color) const
 {
-	const auto colorInt = getIntFromColor(color);
+	auto [r, g, b] = color.getRgbComponents();
+
+	return getProvinceFromColor(r, g, b);
+}
+
+
+std::optional<int> HoI4::ProvinceDefinitions::getProvinceFromColor(const int red, const int green, const int blue) const
+{
+	const auto colorInt = getIntFromColor(red, green, blue);
 
 	if (const auto mapping = colorToProvinceMap.find(colorInt); mapping != colorToProvinceMap.end())
 	{
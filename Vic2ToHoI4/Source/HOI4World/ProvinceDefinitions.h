@@ -30,6 +30,7 @@ class ProvinceDefinitions
 	[[nodiscard]] bool isSeaProvince(const int province) const { return (seaProvinces.contains(province)); }
 
 	[[nodiscard]] std::optional<int> getProvinceFromColor(const commonItems::Color& color) const;
+	[[nodiscard]] std::optional<int> getProvinceFromColor(int red, int green, int blue) const;
 
   private:
 	std::set<int> landProvinces;
@@ -0,0 +1,96 @@
+#include "DisjointProvinceSets.h"
+#include <algorithm>
+#include <numeric>
+
+
+
+HoI4::DisjointProvinceSets::DisjointProvinceSets(const std::set<int>& provinces):
+	 provinces(provinces.begin(), provinces.end()), parents(provinces.size()), sizes(provinces.size(), 1)
+{
+	std::iota(parents.begin(), parents.end(), 0);
+}
+
+
+bool HoI4::DisjointProvinceSets::contains(const int province) const
+{
+	return std::binary_search(provinces.begin(), provinces.end(), province);
+}
+
+
+void HoI4::DisjointProvinceSets::join(const int province1, const int province2)
+{
+	const auto index1 = getIndex(province1);
+	const auto index2 = getIndex(province2);
+	if ((index1 == provinces.size()) || (index2 == provinces.size()))
+	{
+		return;
+	}
+
+	auto root1 = findRoot(index1);
+	auto root2 = findRoot(index2);
+	if (root1 == root2)
+	{
+		return;
+	}
+
+	// hang the smaller tree under the larger so the trees stay shallow
+	if (sizes[root1] < sizes[root2])
+	{
+		std::swap(root1, root2);
+	}
+	parents[root2] = root1;
+	sizes[root1] += sizes[root2];
+}
+
+
+std::vector<std::set<int>> HoI4::DisjointProvinceSets::getSets() const
+{
+	// provinces are visited lowest first, so each set is numbered when its lowest province is reached
+	std::vector<std::set<int>> sets;
+	std::vector<size_t> setOfRoot(provinces.size(), provinces.size());
+	for (size_t index = 0; index < provinces.size(); index++)
+	{
+		const auto root = findRoot(index);
+		if (setOfRoot[root] == provinces.size())
+		{
+			setOfRoot[root] = sets.size();
+			sets.emplace_back();
+		}
+		sets[setOfRoot[root]].insert(sets[setOfRoot[root]].end(), provinces[index]);
+	}
+
+	return sets;
+}
+
+
+size_t HoI4::DisjointProvinceSets::getIndex(const int province) const
+{
+	const auto position = std::lower_bound(provinces.begin(), provinces.end(), province);
+	if ((position == provinces.end()) || (*position != province))
+	{
+		return provinces.size();
+	}
+	return static_cast<size_t>(position - provinces.begin());
+}
+
+
+size_t HoI4::DisjointProvinceSets::findRoot(size_t index)
+{
+	// point every other province on the way at its grandparent, which keeps later searches short
+	while (parents[index] != index)
+	{
+		parents[index] = parents[parents[index]];
+		index = parents[index];
+	}
+	return index;
+}
+
+
+size_t HoI4::DisjointProvinceSets::findRoot(size_t index) const
+{
+	while (parents[index] != index)
+	{
+		index = parents[index];
+	}
+	return index;
+}
\ No newline at end of file
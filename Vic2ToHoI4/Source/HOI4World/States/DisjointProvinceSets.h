@@ -0,0 +1,42 @@
+#ifndef DISJOINT_PROVINCE_SETS_H
+#define DISJOINT_PROVINCE_SETS_H
+
+
+
+#include <cstddef>
+#include <set>
+#include <vector>
+
+
+
+namespace HoI4
+{
+
+// A union-find over a fixed set of provinces. Provinces start out in sets of their own, and joining two provinces
+// merges their sets. Provinces outside the original set are ignored, so the work never grows past the set itself.
+class DisjointProvinceSets
+{
+  public:
+	explicit DisjointProvinceSets(const std::set<int>& provinces);
+
+	[[nodiscard]] bool contains(int province) const;
+	void join(int province1, int province2);
+
+	// the merged sets, ordered by their lowest province
+	[[nodiscard]] std::vector<std::set<int>> getSets() const;
+
+  private:
+	[[nodiscard]] size_t getIndex(int province) const;
+	[[nodiscard]] size_t findRoot(size_t index);
+	[[nodiscard]] size_t findRoot(size_t index) const;
+
+	std::vector<int> provinces; // sorted, so a province's index can be found by binary search
+	std::vector<size_t> parents;
+	std::vector<size_t> sizes;
+};
+
+} // namespace HoI4
+
+
+
+#endif // DISJOINT_PROVINCE_SETS_H
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "HoI4States.h"
 #include "Configuration.h"
 #include "DefaultState.h"
+#include "DisjointProvinceSets.h"
 #include "HOI4World/HoI4Country.h"
 #include "HOI4World/HoI4Localisation.h"
 #include "HOI4World/Localisations/GrammarMappings.h"
@@ -20,7 +21,6 @@
 #include "V2World/States/StateDefinitions.h"
 #include "V2World/States/StateFactory.h"
 #include "V2World/World/World.h"
-#include <queue>
 #include <unordered_map>
 
 
@@ -208,6 +208,8 @@ std::set<std::pair<std::string, std::string>> HoI4::States::determineCores(const
 {
 	std::set<std::pair<std::string, std::string>> cores;
 
+	const auto Vic2OwnerTag = Tag::parse(Vic2Owner);
+	const auto newOwnerTag = Tag::parse(newOwner);
 	for (auto sourceProvinceNum: sourceProvinces)
 	{
 		auto sourceProvince = sourceWorld.getProvince(sourceProvinceNum);
@@ -216,7 +218,7 @@ std::set<std::pair<std::string, std::string>> HoI4::States::determineCores(const
 			continue;
 		}
 
-		for (const auto& Vic2Core: (*sourceProvince)->getCores())
+		for (const auto Vic2Core: (*sourceProvince)->getCores())
 		{
 			auto HoI4CoreTag = countryMap.getHoI4Tag(Vic2Core);
 			if (HoI4CoreTag)
@@ -224,12 +226,12 @@ std::set<std::pair<std::string, std::string>> HoI4::States::determineCores(const
 				// skip this core if the country is the owner of the V2 province but not the HoI4 province
 				// (i.e. "avoid boundary conflicts that didn't exist in V2").
 				// this country may still get core via a province that DID belong to the current HoI4 owner
-				if ((Vic2Core == Vic2Owner) && (*HoI4CoreTag != newOwner))
+				if ((Vic2Core == Vic2OwnerTag) && (*HoI4CoreTag != newOwnerTag))
 				{
 					continue;
 				}
 
-				cores.insert(std::make_pair(Vic2Core, *HoI4CoreTag));
+				cores.insert(std::make_pair(Vic2Core.toString(), HoI4CoreTag->toString()));
 			}
 		}
 	}
@@ -301,7 +303,7 @@ void HoI4::States::createStates(const std::map<std::string, Vic2::Country>& sour
 	{
 		std::unordered_map<int, std::shared_ptr<Vic2::Province>> stateProvinces;
 
-		auto stateProvinceNumbers = theStateDefinitions.getAllProvinces(unownedProvinces.begin()->first);
+		auto stateProvinceNumbers = theStateDefinitions.getStateProvinces(unownedProvinces.begin()->first);
 		if (stateProvinceNumbers.empty())
 		{
 			unownedProvinces.erase(unownedProvinces.begin());
@@ -456,48 +458,28 @@ std::set<int> HoI4::States::getProvincesInState(const Vic2::State& vic2State,
 }
 
 
-std::vector<std::set<int>> HoI4::States::getConnectedProvinceSets(std::set<int> provinceNumbers,
+std::vector<std::set<int>> HoI4::States::getConnectedProvinceSets(const std::set<int>& provinceNumbers,
 	 const MapData& mapData,
 	 const std::map<int, Province>& provinces)
 {
-	std::vector<std::set<int>> connectedProvinceSets;
-	while (!provinceNumbers.empty())
+	// only borders between the state's own provinces matter, so the search never leaves the state
+	DisjointProvinceSets connectedProvinces(provinceNumbers);
+	for (const auto provinceNumber: provinceNumbers)
 	{
-		std::set<int> connectedProvinceSet;
-
-		std::queue<int> openProvinces;
-		openProvinces.push(*provinceNumbers.begin());
-		std::set<int> closedProvinces{*provinceNumbers.begin()};
-		while (!openProvinces.empty() && !provinceNumbers.empty())
+		for (const auto neighbor: mapData.getNeighbors(provinceNumber))
 		{
-			auto currentProvince = openProvinces.front();
-			openProvinces.pop();
-			if (provinceNumbers.contains(currentProvince))
+			if (!connectedProvinces.contains(neighbor))
 			{
-				connectedProvinceSet.insert(currentProvince);
-				provinceNumbers.erase(currentProvince);
+				continue;
 			}
-
-			for (const auto& neighbor: mapData.getNeighbors(currentProvince))
+			if (auto province = provinces.find(neighbor); province != provinces.end() && province->second.isLandProvince())
 			{
-				if (!closedProvinces.contains(neighbor))
-				{
-					if (auto province = provinces.find(neighbor); province != provinces.end())
-					{
-						if (province->second.isLandProvince())
-						{
-							openProvinces.push(neighbor);
-							closedProvinces.insert(neighbor);
-						}
-					}
-				}
+				connectedProvinces.join(provinceNumber, neighbor);
 			}
 		}
-
-		connectedProvinceSets.push_back(connectedProvinceSet);
 	}
 
-	return connectedProvinceSets;
+	return connectedProvinces.getSets();
 }
 
 
@@ -78,6 +78,15 @@ class States: commonItems::parser
 	void addCapitalsToStates(const std::map<std::string, std::shared_ptr<Country>>& countries);
 	void giveProvinceControlToCountry(int provinceNum, const std::string& country);
 
+	// the parts of a state whose land provinces border each other directly, ordered by their lowest province
+	[[nodiscard]] static std::vector<std::set<int>> getConnectedProvinceSets(const std::set<int>& provinceNumbers,
+		 const MapData& mapData,
+		 const std::map<int, Province>& provinces);
+	// merges parts whose lowest provinces are in the same strategic region
+	[[nodiscard]] static std::vector<std::set<int>> consolidateProvinceSets(
+		 std::vector<std::set<int>> connectedProvinceSets,
+		 const std::map<int, int>& provinceToStrategicRegionMap);
+
   private:
 	void determineOwnersAndCores(const Mappers::CountryMapper& countryMap,
 		 const Vic2::World& sourceWorld,
@@ -129,11 +138,6 @@ class States: commonItems::parser
 	std::set<int> getProvincesInState(const Vic2::State& vic2State,
 		 const std::string& owner,
 		 const Mappers::ProvinceMapper& provinceMapper);
-	static std::vector<std::set<int>> getConnectedProvinceSets(std::set<int> provinceNumbers,
-		 const MapData& mapData,
-		 const std::map<int, Province>& provinces);
-	static std::vector<std::set<int>> consolidateProvinceSets(std::vector<std::set<int>> connectedProvinceSets,
-		 const std::map<int, int>& provinceToStrategicRegionMap);
 	void addProvincesAndCoresToNewState(State& newState,
 		 const std::map<std::string, Vic2::Country>& sourceCountries,
 		 const std::set<int>& provinceNumbers,
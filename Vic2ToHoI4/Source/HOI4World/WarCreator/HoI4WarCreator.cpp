@@ -55,6 +55,8 @@ HoI4WarCreator::HoI4WarCreator(HoI4::World* world,
 		 provinceDefinitions,
 		 hoi4Localisations,
 		 theConfiguration);
+	Log(LogLevel::Debug) << "\t\tCalculated " << mapUtils.getNumberOfDistancesCalculated()
+								<< " distances between countries";
 
 	if (theConfiguration.getDebug())
 	{
@@ -1,6 +1,7 @@
 #include "MapUtils.h"
 #include "HOI4World/States/HoI4State.h"
 #include "Log.h"
+#include <algorithm>
 #include <limits>
 #include <ranges>
 #include <sstream>
@@ -8,17 +9,16 @@
 
 
 constexpr int mapWidth = 5250;
-constexpr int halfMapWidth = mapWidth / 2;
 
 
 
 HoI4::MapUtils::MapUtils(const std::map<int, State>& theStates,
-	 const std::map<std::string, std::shared_ptr<Country>>& theCountries)
+	 const std::map<std::string, std::shared_ptr<Country>>& theCountries):
+	 theCountries(theCountries)
 {
 	Log(LogLevel::Info) << "Determining HoI4 map information";
 	establishProvincePositions();
 	determineProvinceOwners(theStates);
-	establishDistancesBetweenCountries(theCountries);
 }
 
 
@@ -84,44 +84,14 @@ void HoI4::MapUtils::determineProvinceOwners(const std::map<int, State>& theStat
 {
 	for (const auto& state: theStates | std::ranges::views::values)
 	{
-		for (auto province: state.getProvinces())
+		const auto owner = Tag::parse(state.getOwner());
+		if (!owner)
 		{
-			std::string owner = state.getOwner();
-			provinceToOwnerMap.insert(std::make_pair(province, owner));
+			continue;
 		}
-	}
-}
-
-
-void HoI4::MapUtils::establishDistancesBetweenCountries(
-	 const std::map<std::string, std::shared_ptr<Country>>& theCountries)
-{
-	for (const auto& [tagOne, countryOne]: theCountries)
-	{
-		for (const auto& [tagTwo, countryTwo]: theCountries)
+		for (auto province: state.getProvinces())
 		{
-			// no need to know the distance to one's self
-			if (tagOne == tagTwo)
-			{
-				continue;
-			}
-
-			// we already found the distance from two to one
-			if (const auto itr = distancesBetweenCountries.find(tagTwo); itr != distancesBetweenCountries.end())
-			{
-				if (const auto itr2 = itr->second.find(tagOne); itr2 != itr->second.end())
-				{
-					distancesBetweenCountries[tagOne].emplace(tagTwo, itr2->second);
-					continue;
-				}
-			}
-
-			// this is a new distance to calculate
-			auto distance = getDistanceBetweenCountries(*countryOne, *countryTwo);
-			if (distance)
-			{
-				distancesBetweenCountries[tagOne].emplace(tagTwo, *distance);
-			}
+			provinceToOwnerMap.emplace(province, *owner);
 		}
 	}
 }
@@ -177,11 +147,12 @@ std::set<int> HoI4::MapUtils::findBorderStates(const Country& country,
 		}
 	}
 
+	const auto neighborTag = Tag::parse(neighbor.getTag());
 	std::set<int> borderStates;
 	for (const auto borderProvince: borderProvinces)
 	{
 		if (const auto provinceAndOwner = provinceToOwnerMap.find(borderProvince);
-			 provinceAndOwner != provinceToOwnerMap.end() && provinceAndOwner->second == neighbor.getTag())
+			 provinceAndOwner != provinceToOwnerMap.end() && provinceAndOwner->second == neighborTag)
 		{
 			if (const auto provinceAndState = provinceToStateIdMapping.find(borderProvince);
 				 provinceAndState != provinceToStateIdMapping.end())
@@ -229,18 +200,35 @@ std::vector<int> HoI4::MapUtils::sortStatesByDistance(const std::set<int>& state
 }
 
 
-std::set<std::string> HoI4::MapUtils::getNearbyCountries(const std::string& country, float range) const
+std::set<std::string> HoI4::MapUtils::getNearbyCountries(const std::string& country, float range)
 {
-	const auto countriesAndDistances = distancesBetweenCountries.find(country);
-	if (countriesAndDistances == distancesBetweenCountries.end())
+	const auto theCountry = theCountries.find(country);
+	if (theCountry == theCountries.end())
 	{
 		return {};
 	}
+	const auto countryTag = Tag::parse(country);
+	if (!countryTag)
+	{
+		Log(LogLevel::Warning) << "Could not find the distances from " << country;
+		return {};
+	}
 
 	std::set<std::string> nearbyCountries;
-	for (const auto& [tag, distance]: countriesAndDistances->second)
+	for (const auto& [tag, otherCountry]: theCountries)
 	{
-		if (distance <= range)
+		const auto otherTag = Tag::parse(tag);
+		if (!otherTag)
+		{
+			Log(LogLevel::Warning) << "Could not find the distance between " << country << " and " << tag;
+			continue;
+		}
+		if (*otherTag == *countryTag)
+		{
+			continue;
+		}
+		const auto distance = getDistanceBetweenCountries(*countryTag, *theCountry->second, *otherTag, *otherCountry);
+		if (distance && *distance <= range)
 		{
 			nearbyCountries.insert(tag);
 		}
@@ -250,18 +238,35 @@ std::set<std::string> HoI4::MapUtils::getNearbyCountries(const std::string& coun
 }
 
 
-std::set<std::string> HoI4::MapUtils::getFarCountries(const std::string& country, float range) const
+std::set<std::string> HoI4::MapUtils::getFarCountries(const std::string& country, float range)
 {
-	const auto countriesAndDistances = distancesBetweenCountries.find(country);
-	if (countriesAndDistances == distancesBetweenCountries.end())
+	const auto theCountry = theCountries.find(country);
+	if (theCountry == theCountries.end())
+	{
+		return {};
+	}
+	const auto countryTag = Tag::parse(country);
+	if (!countryTag)
 	{
+		Log(LogLevel::Warning) << "Could not find the distances from " << country;
 		return {};
 	}
 
 	std::set<std::string> farCountries;
-	for (const auto& [tag, distance]: countriesAndDistances->second)
+	for (const auto& [tag, otherCountry]: theCountries)
 	{
-		if (distance > range)
+		const auto otherTag = Tag::parse(tag);
+		if (!otherTag)
+		{
+			Log(LogLevel::Warning) << "Could not find the distance between " << country << " and " << tag;
+			continue;
+		}
+		if (*otherTag == *countryTag)
+		{
+			continue;
+		}
+		const auto distance = getDistanceBetweenCountries(*countryTag, *theCountry->second, *otherTag, *otherCountry);
+		if (distance && *distance > range)
 		{
 			farCountries.insert(tag);
 		}
@@ -307,21 +312,60 @@ std::optional<HoI4::Coordinate> HoI4::MapUtils::getProvincePosition(int province
 
 float HoI4::MapUtils::getDistanceSquaredBetweenPoints(const Coordinate& point1, const Coordinate& point2)
 {
-	auto xDistance = static_cast<float>(abs(point2.x - point1.x));
-	if (xDistance > halfMapWidth)
+	return getWrappedDistanceSquared(point1, point2, mapWidth);
+}
+
+
+const HoI4::ProvincePositionGrid& HoI4::MapUtils::getProvincePositionGrid(const Tag tag, const Country& country)
+{
+	if (const auto grid = provincePositionGrids.find(tag); grid != provincePositionGrids.end())
 	{
-		xDistance = mapWidth - xDistance;
+		return grid->second;
 	}
 
-	const auto yDistance = static_cast<float>(point2.y - point1.y);
+	std::vector<Coordinate> positions;
+	for (auto province: country.getProvinces())
+	{
+		if (auto position = getProvincePosition(province); position)
+		{
+			positions.push_back(*position);
+		}
+	}
+
+	return provincePositionGrids.emplace(tag, ProvincePositionGrid(positions, mapWidth)).first->second;
+}
 
-	const auto distance = xDistance * xDistance + yDistance * yDistance;
 
+std::optional<float> HoI4::MapUtils::getDistanceBetweenCountries(const Tag tag1,
+	 const Country& country1,
+	 const Tag tag2,
+	 const Country& country2)
+{
+	// the distance is the same both ways, so it's only worked out and stored with the tags in order
+	if (tag2 < tag1)
+	{
+		return getDistanceBetweenCountries(tag2, country2, tag1, country1);
+	}
+
+	const auto key = (static_cast<std::uint64_t>(tag1.getPacked()) << 32U) | tag2.getPacked();
+	if (const auto distance = distancesBetweenCountries.find(key); distance != distancesBetweenCountries.end())
+	{
+		return distance->second;
+	}
+
+	const auto distance = calculateDistanceBetweenCountries(country1,
+		 country2,
+		 getProvincePositionGrid(tag1, country1),
+		 getProvincePositionGrid(tag2, country2));
+	distancesBetweenCountries.emplace(key, distance);
 	return distance;
 }
 
 
-std::optional<float> HoI4::MapUtils::getDistanceBetweenCountries(const Country& country1, const Country& country2)
+std::optional<float> HoI4::MapUtils::calculateDistanceBetweenCountries(const Country& country1,
+	 const Country& country2,
+	 const ProvincePositionGrid& country1Provinces,
+	 const ProvincePositionGrid& country2Provinces)
 {
 	auto distanceBetweenCapitals = getDistanceBetweenCapitals(country1, country2);
 	if (!distanceBetweenCapitals)
@@ -329,27 +373,16 @@ std::optional<float> HoI4::MapUtils::getDistanceBetweenCountries(const Country&
 		return std::nullopt;
 	}
 
+	// look up each province of the smaller country in the grid of the larger one
+	const auto country1IsSmaller = country1Provinces.size() <= country2Provinces.size();
+	const auto& searchFrom = country1IsSmaller ? country1Provinces : country2Provinces;
+	const auto& searchIn = country1IsSmaller ? country2Provinces : country1Provinces;
+
 	auto distanceSquared = *distanceBetweenCapitals * *distanceBetweenCapitals;
-	for (auto province1: country1.getProvinces())
+	for (size_t i = 0; i < searchFrom.size(); i++)
 	{
-		auto province1Position = getProvincePosition(province1);
-		if (!province1Position)
-		{
-			continue;
-		}
-
-		for (auto province2: country2.getProvinces())
-		{
-			auto province2Position = getProvincePosition(province2);
-			if (!province2Position)
-			{
-				continue;
-			}
-
-			distanceSquared =
-				 std::min(distanceSquared, getDistanceSquaredBetweenPoints(*province1Position, *province2Position));
-		}
+		distanceSquared = searchIn.getNearestDistanceSquared(searchFrom.getPosition(i), distanceSquared);
 	}
 
 	return std::sqrt(distanceSquared);
-}
+}
\ No newline at end of file
@@ -5,23 +5,18 @@
 
 #include "HOI4World/HoI4Country.h"
 #include "HOI4World/HoI4World.h"
+#include "ProvincePositionGrid.h"
+#include "Tag.h"
+#include <cstdint>
 #include <memory>
 #include <optional>
+#include <unordered_map>
 
 
 
 namespace HoI4
 {
 
-struct Coordinate
-{
-	int x;
-	int y;
-
-	auto operator<=>(const Coordinate&) const = default;
-};
-
-
 class MapUtils
 {
   public:
@@ -42,26 +37,39 @@ class MapUtils
 		 const Coordinate& location,
 		 const std::map<int, State>& states);
 
-	[[nodiscard]] std::set<std::string> getNearbyCountries(const std::string& country, float range) const;
-	[[nodiscard]] std::set<std::string> getFarCountries(const std::string& country, float range) const;
+	[[nodiscard]] std::set<std::string> getNearbyCountries(const std::string& country, float range);
+	[[nodiscard]] std::set<std::string> getFarCountries(const std::string& country, float range);
 	[[nodiscard]] std::vector<std::string> getGPsByDistance(const Country& country,
 		 const std::vector<std::shared_ptr<Country>>& greatPowers);
 
+	[[nodiscard]] auto getNumberOfDistancesCalculated() const { return distancesBetweenCountries.size(); }
+
   private:
 	void establishProvincePositions();
 	void addProvincePosition(const std::vector<std::string>& lineTokens);
 	[[nodiscard]] std::vector<std::string> tokenizeLine(const std::string& line) const;
 	void processPositionLine(const std::string& line);
 	void determineProvinceOwners(const std::map<int, State>& theStates);
-	void establishDistancesBetweenCountries(const std::map<std::string, std::shared_ptr<Country>>& theCountries);
 
 	[[nodiscard]] std::optional<Coordinate> getProvincePosition(int provinceNum) const;
 	[[nodiscard]] float getDistanceSquaredBetweenPoints(const Coordinate& point1, const Coordinate& point2);
-	[[nodiscard]] std::optional<float> getDistanceBetweenCountries(const Country& country1, const Country& country2);
+	[[nodiscard]] const ProvincePositionGrid& getProvincePositionGrid(Tag tag, const Country& country);
+	[[nodiscard]] std::optional<float> getDistanceBetweenCountries(Tag tag1,
+		 const Country& country1,
+		 Tag tag2,
+		 const Country& country2);
+	[[nodiscard]] std::optional<float> calculateDistanceBetweenCountries(const Country& country1,
+		 const Country& country2,
+		 const ProvincePositionGrid& country1Provinces,
+		 const ProvincePositionGrid& country2Provinces);
 
 	std::map<int, Coordinate> provincePositions;
-	std::map<int, std::string> provinceToOwnerMap;
-	std::map<std::string, std::map<std::string, float>> distancesBetweenCountries;
+	std::unordered_map<int, Tag> provinceToOwnerMap;
+	const std::map<std::string, std::shared_ptr<Country>>& theCountries;
+
+	// filled in as distances are asked for, since only a few countries ever need them
+	std::unordered_map<Tag, ProvincePositionGrid> provincePositionGrids;
+	std::unordered_map<std::uint64_t, std::optional<float>> distancesBetweenCountries; // both tags, lower one first
 };
 
 } // namespace HoI4
@@ -0,0 +1,203 @@
+#include "ProvincePositionGrid.h"
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+
+
+
+constexpr int targetCellSize = 128;
+
+
+// The smallest wrapped squared distance from (x, y) to any of count positions. It's kept free of branches so the
+// compiler can vectorize it. The distances are computed as integers, which gives exactly the values
+// getWrappedDistanceSquared does for map-sized coordinates.
+int findNearestDistanceSquared(const int* xPositions,
+	 const int* yPositions,
+	 size_t count,
+	 int x,
+	 int y,
+	 int mapWidth,
+	 int limit);
+
+
+
+float HoI4::getWrappedDistanceSquared(const Coordinate& point1, const Coordinate& point2, const int mapWidth)
+{
+	auto xDistance = static_cast<float>(abs(point2.x - point1.x));
+	if (xDistance > mapWidth / 2)
+	{
+		xDistance = mapWidth - xDistance;
+	}
+
+	const auto yDistance = static_cast<float>(point2.y - point1.y);
+
+	return xDistance * xDistance + yDistance * yDistance;
+}
+
+
+HoI4::ProvincePositionGrid::ProvincePositionGrid(const std::vector<Coordinate>& unsortedPositions,
+	 const int mapWidth):
+	 mapWidth(mapWidth),
+	 numColumns(std::max(mapWidth / targetCellSize, 1)), cellSize(std::max(mapWidth / numColumns, 1))
+{
+	if (unsortedPositions.empty())
+	{
+		cellStarts.push_back(0);
+		return;
+	}
+
+	const auto [lowest, highest] = std::minmax_element(unsortedPositions.begin(),
+		 unsortedPositions.end(),
+		 [](const Coordinate& a, const Coordinate& b) {
+			 return a.y < b.y;
+		 });
+	lowestY = lowest->y;
+	numRows = getRow(highest->y) + 1;
+
+	// count the positions in each cell, turn the counts into starting points, then drop each position into its cell
+	cellStarts.assign(static_cast<size_t>(numRows) * numColumns + 1, 0);
+	for (const auto& position: unsortedPositions)
+	{
+		cellStarts[static_cast<size_t>(getRow(position.y)) * numColumns + getColumn(position.x) + 1]++;
+	}
+	for (size_t cell = 1; cell < cellStarts.size(); cell++)
+	{
+		cellStarts[cell] += cellStarts[cell - 1];
+	}
+
+	xPositions.resize(unsortedPositions.size());
+	yPositions.resize(unsortedPositions.size());
+	auto nextSlots = cellStarts;
+	for (const auto& position: unsortedPositions)
+	{
+		const auto slot = nextSlots[static_cast<size_t>(getRow(position.y)) * numColumns + getColumn(position.x)]++;
+		xPositions[slot] = position.x;
+		yPositions[slot] = position.y;
+	}
+}
+
+
+float HoI4::ProvincePositionGrid::getNearestDistanceSquared(const Coordinate& position, const float limit) const
+{
+	if (xPositions.empty())
+	{
+		return limit;
+	}
+
+	const auto row = getRow(position.y);
+	const auto column = getColumn(position.x);
+
+	// Search outwards one ring of cells at a time. Every cell in ring r is at least (r - 1) cells away in one direction,
+	// and columns are at least cellSize wide, so once that distance reaches the nearest found nothing further can win.
+	auto nearest = limit;
+	const auto lastRing = std::max({numColumns / 2, row, numRows - 1 - row});
+	for (auto ring = 0; ring <= lastRing; ring++)
+	{
+		if (const auto ringDistance = static_cast<float>((ring - 1) * cellSize);
+			 ring > 1 && ringDistance * ringDistance >= nearest)
+		{
+			break;
+		}
+
+		const auto firstRow = std::max(row - ring, 0);
+		const auto lastRow = std::min(row + ring, numRows - 1);
+		for (auto cellRow = firstRow; cellRow <= lastRow; cellRow++)
+		{
+			if (std::abs(cellRow - row) == ring)
+			{
+				// the top and bottom of the ring, which may reach all the way around the map
+				if (2 * ring + 1 >= numColumns)
+				{
+					for (auto cellColumn = 0; cellColumn < numColumns; cellColumn++)
+					{
+						nearest = getNearestDistanceSquaredInCell(position, cellRow, cellColumn, nearest);
+					}
+				}
+				else
+				{
+					for (auto offset = -ring; offset <= ring; offset++)
+					{
+						nearest = getNearestDistanceSquaredInCell(position, cellRow, column + offset, nearest);
+					}
+				}
+			}
+			else if (2 * ring < numColumns)
+			{
+				// the sides of the ring, unless they've wrapped around to columns that were already searched
+				nearest = getNearestDistanceSquaredInCell(position, cellRow, column - ring, nearest);
+				nearest = getNearestDistanceSquaredInCell(position, cellRow, column + ring, nearest);
+			}
+			else if (2 * ring == numColumns)
+			{
+				// both sides of the ring are the same column
+				nearest = getNearestDistanceSquaredInCell(position, cellRow, column + ring, nearest);
+			}
+		}
+	}
+
+	return nearest;
+}
+
+
+float HoI4::ProvincePositionGrid::getNearestDistanceSquaredInCell(const Coordinate& position,
+	 const int row,
+	 const int column,
+	 float limit) const
+{
+	const auto wrappedColumn = ((column % numColumns) + numColumns) % numColumns;
+	const auto cell = static_cast<size_t>(row) * numColumns + wrappedColumn;
+	const auto start = cellStarts[cell];
+	const auto count = cellStarts[cell + 1] - start;
+	if (count == 0)
+	{
+		return limit;
+	}
+
+	const auto nearest = findNearestDistanceSquared(&xPositions[start],
+		 &yPositions[start],
+		 count,
+		 position.x,
+		 position.y,
+		 mapWidth,
+		 std::numeric_limits<int>::max());
+	return std::min(limit, static_cast<float>(nearest));
+}
+
+
+int findNearestDistanceSquared(const int* xPositions,
+	 const int* yPositions,
+	 const size_t count,
+	 const int x,
+	 const int y,
+	 const int mapWidth,
+	 int limit)
+{
+	const auto halfMapWidth = mapWidth / 2;
+	for (size_t i = 0; i < count; i++)
+	{
+		auto xDistance = std::abs(xPositions[i] - x);
+		xDistance = (xDistance > halfMapWidth) ? mapWidth - xDistance : xDistance;
+		const auto yDistance = yPositions[i] - y;
+		const auto distance = xDistance * xDistance + yDistance * yDistance;
+		limit = (distance < limit) ? distance : limit;
+	}
+
+	return limit;
+}
+
+
+int HoI4::ProvincePositionGrid::getColumn(const int x) const
+{
+	const auto wrappedX = ((x % mapWidth) + mapWidth) % mapWidth;
+	return static_cast<int>(static_cast<long long>(wrappedX) * numColumns / mapWidth);
+}
+
+
+int HoI4::ProvincePositionGrid::getRow(const int y) const
+{
+	if (y >= lowestY)
+	{
+		return (y - lowestY) / cellSize;
+	}
+	return -((lowestY - y + cellSize - 1) / cellSize);
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#ifndef PROVINCE_POSITION_GRID_H
+#define PROVINCE_POSITION_GRID_H
+
+
+
+#include <compare>
+#include <cstddef>
+#include <vector>
+
+
+
+namespace HoI4
+{
+
+struct Coordinate
+{
+	int x;
+	int y;
+
+	auto operator<=>(const Coordinate&) const = default;
+};
+
+
+// the squared distance between two points, going around the east and west edges of the map when that is shorter
+[[nodiscard]] float getWrappedDistanceSquared(const Coordinate& point1, const Coordinate& point2, int mapWidth);
+
+
+// Buckets positions into square cells so a nearest-position query only needs to look at the cells near it. Columns
+// wrap around the east and west edges of the map, just like getWrappedDistanceSquared.
+class ProvincePositionGrid
+{
+  public:
+	ProvincePositionGrid(const std::vector<Coordinate>& unsortedPositions, int mapWidth);
+
+	[[nodiscard]] size_t size() const { return xPositions.size(); }
+	[[nodiscard]] Coordinate getPosition(const size_t index) const { return {xPositions[index], yPositions[index]}; }
+
+	// the squared distance from position to the nearest position in the grid, or limit if none are closer than that
+	[[nodiscard]] float getNearestDistanceSquared(const Coordinate& position, float limit) const;
+
+  private:
+	[[nodiscard]] int getColumn(int x) const;
+	[[nodiscard]] int getRow(int y) const;
+	[[nodiscard]] float getNearestDistanceSquaredInCell(const Coordinate& position,
+		 int row,
+		 int column,
+		 float limit) const;
+
+	int mapWidth;
+	int numColumns;
+	int cellSize;
+	int numRows = 0;
+	int lowestY = 0;
+
+	// positions are stored as separate x and y arrays so each cell can be searched with one tight loop.
+	// They are grouped by cell, row by row
+	std::vector<int> xPositions;
+	std::vector<int> yPositions;
+	std::vector<size_t> cellStarts; // where each cell's positions start, plus the end of the last cell
+};
+
+} // namespace HoI4
+
+
+
+#endif // PROVINCE_POSITION_GRID_H
\ No newline at end of file
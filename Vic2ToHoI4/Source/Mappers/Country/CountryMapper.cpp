@@ -1,15 +1,47 @@
 #include "CountryMapper.h"
 #include "V2World/World/World.h"
+#include <algorithm>
 
 
 
 std::optional<std::string> Mappers::CountryMapper::getHoI4Tag(const std::string& V2Tag) const
 {
-	const auto mapping = Vic2TagToHoI4TagMap.find(V2Tag);
-	if (mapping == Vic2TagToHoI4TagMap.end())
+	const auto tag = Tag::parse(V2Tag);
+	if (!tag)
+	{
+		return std::nullopt;
+	}
+
+	const auto HoI4Tag = getHoI4Tag(*tag);
+	if (!HoI4Tag)
+	{
+		return std::nullopt;
+	}
+
+	return HoI4Tag->toString();
+}
+
+
+std::optional<Tag> Mappers::CountryMapper::getHoI4Tag(const Tag V2Tag) const
+{
+	const auto mapping = std::ranges::lower_bound(Vic2TagsToHoI4Tags, V2Tag, {}, &std::pair<Tag, Tag>::first);
+	if (mapping == Vic2TagsToHoI4Tags.end() || mapping->first != V2Tag)
 	{
 		return std::nullopt;
 	}
 
 	return mapping->second;
+}
+
+
+void Mappers::CountryMapper::addMapping(const Tag Vic2Tag, const Tag HoI4Tag)
+{
+	const auto mapping = std::ranges::lower_bound(Vic2TagsToHoI4Tags, Vic2Tag, {}, &std::pair<Tag, Tag>::first);
+	if (mapping != Vic2TagsToHoI4Tags.end() && mapping->first == Vic2Tag)
+	{
+		mapping->second = HoI4Tag;
+		return;
+	}
+
+	Vic2TagsToHoI4Tags.insert(mapping, std::make_pair(Vic2Tag, HoI4Tag));
 }
\ No newline at end of file
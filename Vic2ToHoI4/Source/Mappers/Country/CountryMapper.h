@@ -4,9 +4,11 @@
 
 
 #include "Parser.h"
-#include <map>
+#include "Tag.h"
 #include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 
 
@@ -20,9 +22,13 @@ class CountryMapper
 	class Factory;
 
 	[[nodiscard]] std::optional<std::string> getHoI4Tag(const std::string& V2Tag) const;
+	[[nodiscard]] std::optional<Tag> getHoI4Tag(Tag V2Tag) const;
 
   private:
-	std::map<std::string, std::string> Vic2TagToHoI4TagMap;
+	void addMapping(Tag Vic2Tag, Tag HoI4Tag);
+
+	// sorted by Vic2 tag, so a lookup is a binary search over packed tags
+	std::vector<std::pair<Tag, Tag>> Vic2TagsToHoI4Tags;
 };
 
 } // namespace Mappers
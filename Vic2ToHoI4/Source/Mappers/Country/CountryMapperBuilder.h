@@ -20,7 +20,7 @@ class CountryMapper::Builder
 
 	Builder& addMapping(const std::string& Vic2Tag, const std::string& HoI4Tag)
 	{
-		countryMapper->Vic2TagToHoI4TagMap[Vic2Tag] = HoI4Tag;
+		countryMapper->addMapping(Tag::parse(Vic2Tag).value(), Tag::parse(HoI4Tag).value());
 		return *this;
 	}
 
@@ -66,12 +66,20 @@ void Mappers::CountryMapper::Factory::resetMappingData()
 
 void Mappers::CountryMapper::Factory::makeOneMapping(const std::string& Vic2Tag, bool debug)
 {
+	const auto parsedVic2Tag = Tag::parse(Vic2Tag);
+	if (!parsedVic2Tag)
+	{
+		Log(LogLevel::Warning) << "Could not map " << Vic2Tag << ", as it is not a three-character tag";
+		return;
+	}
+
 	if (const auto mappingRule = Vic2TagToHoI4TagsRules.find(Vic2Tag); mappingRule != Vic2TagToHoI4TagsRules.end())
 	{
 		const auto& possibleHoI4Tag = mappingRule->second;
-		if (!tagIsAlreadyAssigned(possibleHoI4Tag))
+		const auto parsedHoI4Tag = Tag::parse(possibleHoI4Tag);
+		if (parsedHoI4Tag && !tagIsAlreadyAssigned(possibleHoI4Tag))
 		{
-			countryMapper->Vic2TagToHoI4TagMap.insert(make_pair(Vic2Tag, possibleHoI4Tag));
+			countryMapper->addMapping(*parsedVic2Tag, *parsedHoI4Tag);
 			assignedTags.insert(possibleHoI4Tag);
 			if (debug)
 			{
@@ -81,7 +89,7 @@ void Mappers::CountryMapper::Factory::makeOneMapping(const std::string& Vic2Tag,
 		}
 	}
 
-	mapToNewTag(Vic2Tag, generateNewHoI4Tag(), debug);
+	mapToNewTag(*parsedVic2Tag, generateNewHoI4Tag(), debug);
 }
 
 
@@ -108,12 +116,12 @@ std::string Mappers::CountryMapper::Factory::generateNewHoI4Tag()
 }
 
 
-void Mappers::CountryMapper::Factory::mapToNewTag(const std::string& Vic2Tag, const std::string& HoI4Tag, bool debug)
+void Mappers::CountryMapper::Factory::mapToNewTag(const Tag Vic2Tag, const std::string& HoI4Tag, bool debug)
 {
-	countryMapper->Vic2TagToHoI4TagMap.insert(make_pair(Vic2Tag, HoI4Tag));
+	countryMapper->addMapping(Vic2Tag, Tag::parse(HoI4Tag).value());
 	assignedTags.insert(HoI4Tag);
 	if (debug)
 	{
-		logMapping(Vic2Tag, HoI4Tag, "generated tag");
+		logMapping(Vic2Tag.toString(), HoI4Tag, "generated tag");
 	}
 }
\ No newline at end of file
@@ -28,7 +28,7 @@ class CountryMapper::Factory: commonItems::parser
 	void makeOneMapping(const std::string& Vic2Tag, bool debug);
 	[[nodiscard]] bool tagIsAlreadyAssigned(const std::string& HoI4Tag) const;
 	[[nodiscard]] std::string generateNewHoI4Tag();
-	void mapToNewTag(const std::string& Vic2Tag, const std::string& HoI4Tag, bool debug);
+	void mapToNewTag(Tag Vic2Tag, const std::string& HoI4Tag, bool debug);
 
 	CountryMappingRuleFactory countryMappingRuleFactory;
 	std::map<std::string, std::string> Vic2TagToHoI4TagsRules;
@@ -1,6 +1,6 @@
 #include "OutDecisions.h"
 #include "OutDecisionsCategories.h"
-#include <fstream>
+#include "OutHoi4/OutputFile.h"
 
 
 
@@ -11,7 +11,7 @@ void HoI4::outputDecisions(const decisions& theDecisions,
 	outputDecisionCategories("output/" + outputName + "/common/decisions/categories/00_decision_categories.txt",
 		 theDecisions.getIdeologicalCategories());
 
-	std::ofstream outStream("output/" + outputName + "/common/decisions/lar_agent_recruitment_decisions.txt");
+	OutputFile outStream("output/" + outputName + "/common/decisions/lar_agent_recruitment_decisions.txt");
 	if (!outStream.is_open())
 	{
 		throw std::runtime_error(
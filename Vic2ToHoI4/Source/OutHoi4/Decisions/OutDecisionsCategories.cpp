@@ -1,12 +1,12 @@
 #include "OutDecisionsCategories.h"
 #include "OutDecisionsCategory.h"
-#include <fstream>
+#include "OutHoi4/OutputFile.h"
 
 
 
 void HoI4::outputDecisionCategories(const std::string& filename, const DecisionsCategories& categories)
 {
-	std::ofstream out(filename);
+	OutputFile out(filename);
 	if (!out.is_open())
 	{
 		throw std::runtime_error("Could not open " + filename);
@@ -1,6 +1,6 @@
 #include "OutEvents.h"
 #include "OSCompatibilityLayer.h"
-#include <fstream>
+#include "OutHoi4/OutputFile.h"
 
 
 
@@ -48,7 +48,7 @@ void outputActualEvents(const std::string& eventsFileName,
 	 const std::vector<HoI4::Event>& events,
 	 const std::string& outputName)
 {
-	std::ofstream outEvents("output/" + outputName + "/events/" + eventsFileName);
+	HoI4::OutputFile outEvents("output/" + outputName + "/events/" + eventsFileName);
 	if (!outEvents.is_open())
 	{
 		throw std::runtime_error("Could not create " + eventsFileName);
@@ -68,7 +68,8 @@ void outputActualEvents(const std::string& eventsFileName,
 
 void outputWarJustificationEvents(const std::vector<HoI4::Event>& warJustificationEvents, const std::string& outputName)
 {
-	std::ofstream outWarJustificationEvents("output/" + outputName + "/events/WarJustification.txt", std::ios_base::app);
+	HoI4::OutputFile outWarJustificationEvents("output/" + outputName + "/events/WarJustification.txt",
+		 std::ios_base::app);
 	if (!outWarJustificationEvents.is_open())
 	{
 		throw std::runtime_error("Could not open WarJustification.txt");
@@ -89,7 +90,7 @@ void outputStabilityEvents(const std::map<std::string, HoI4::Event>& stabilityEv
 	 const std::map<std::string, HoI4::Event>& mutinyEvents,
 	 const std::string& outputName)
 {
-	std::ofstream outStabilityEvents("output/" + outputName + "/events/stability_events.txt");
+	HoI4::OutputFile outStabilityEvents("output/" + outputName + "/events/stability_events.txt");
 	if (!outStabilityEvents.is_open())
 	{
 		throw std::runtime_error("Could not open StabilityEvents.txt");
@@ -129,7 +130,7 @@ void outputStabilityEvents(const std::map<std::string, HoI4::Event>& stabilityEv
 
 void outputGovernmentInExileDecision(const HoI4::Event& governmentInExileEvent, const std::string& outputName)
 {
-	std::ofstream outEvents("output/" + outputName + "/events/MTG_generic.txt", std::ofstream::app);
+	HoI4::OutputFile outEvents("output/" + outputName + "/events/MTG_generic.txt", std::ios_base::app);
 	if (!outEvents.is_open())
 	{
 		throw std::runtime_error("Could not add to MTG_generic.txt");
@@ -0,0 +1,104 @@
+#include "FlagCache.h"
+#include "OSCompatibilityLayer.h"
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+
+
+HoI4::FlagCache::FlagCache(std::string folder, const int version):
+	 folder(std::move(folder)), versionPrefix("v" + std::to_string(version) + "_")
+{
+	// flags can always be made from scratch, so a cache that can't be kept just goes unused
+	usable = commonItems::TryCreateFolder(this->folder);
+	if (usable)
+	{
+		removeOtherVersions();
+	}
+}
+
+
+void HoI4::FlagCache::removeOtherVersions() const
+{
+	for (const auto& filename: commonItems::GetAllFilesInFolder(folder))
+	{
+		// partly written flags are left alone, as another conversion may still be writing them
+		if (filename.ends_with(".tga") && !filename.starts_with(versionPrefix))
+		{
+			std::remove((folder + "/" + filename).c_str());
+		}
+	}
+}
+
+
+std::string HoI4::FlagCache::getCachedPath(const std::string& key) const
+{
+	return folder + "/" + versionPrefix + key + ".tga";
+}
+
+
+std::optional<std::string> HoI4::FlagCache::getContentKey(const std::string& path)
+{
+	std::ifstream file(path, std::ios::binary | std::ios::ate);
+	if (!file.is_open())
+	{
+		return std::nullopt;
+	}
+
+	std::string contents;
+	contents.resize(static_cast<size_t>(file.tellg()));
+	file.seekg(0);
+	file.read(contents.data(), static_cast<std::streamsize>(contents.size()));
+	contents.resize(static_cast<size_t>(file.gcount()));
+
+	// 64-bit FNV-1a, which unlike std::hash is the same for every build, along with the size to make collisions rarer
+	uint64_t hash = 0xcbf29ce484222325;
+	for (const auto character: contents)
+	{
+		hash ^= static_cast<uint8_t>(character);
+		hash *= 0x100000001b3;
+	}
+
+	std::stringstream key;
+	key << std::hex << std::setfill('0') << std::setw(16) << hash << std::dec << '_' << contents.size();
+	return key.str();
+}
+
+
+bool HoI4::FlagCache::copyCachedFlag(const std::string& key, const std::string& destination) const
+{
+	const auto cachedPath = getCachedPath(key);
+	if (!usable || !commonItems::DoesFileExist(cachedPath))
+	{
+		return false;
+	}
+
+	return commonItems::TryCopyFile(cachedPath, destination);
+}
+
+
+void HoI4::FlagCache::addFlag(const std::string& key, const std::string& flagPath) const
+{
+	if (!usable)
+	{
+		return;
+	}
+
+	// Flags are made on several threads at once, and several conversions may share the cache, so two writers can cache
+	// the same flag. Each copies to a randomly named file of its own and then renames it, so a reader never sees a flag
+	// that's only partly written.
+	thread_local std::mt19937_64 randomNumbers{std::random_device{}()};
+	const auto cachedPath = getCachedPath(key);
+	const auto partialPath = cachedPath + "." + std::to_string(randomNumbers()) + ".partial";
+	if (!commonItems::TryCopyFile(flagPath, partialPath))
+	{
+		return;
+	}
+	if (std::rename(partialPath.c_str(), cachedPath.c_str()) != 0)
+	{
+		std::remove(partialPath.c_str());
+	}
+}
\ No newline at end of file
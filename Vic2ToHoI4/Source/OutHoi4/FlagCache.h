@@ -0,0 +1,42 @@
+#ifndef FLAG_CACHE_H
+#define FLAG_CACHE_H
+
+
+
+#include <optional>
+#include <string>
+
+
+
+namespace HoI4
+{
+
+// Keeps flags that have already been made in a folder that outlives the conversion, named by keys derived from the
+// contents of the flags they were made from. A later conversion that uses the same source flag, from wherever it's
+// found, copies the finished file instead of making it again. Flags cached under any other version are removed, so
+// the cache only ever holds one set of flags for each source.
+class FlagCache
+{
+  public:
+	FlagCache(std::string folder, int version);
+
+	// a key for the contents of a file, or nothing if the file can't be read
+	[[nodiscard]] static std::optional<std::string> getContentKey(const std::string& path);
+
+	[[nodiscard]] bool copyCachedFlag(const std::string& key, const std::string& destination) const;
+	void addFlag(const std::string& key, const std::string& flagPath) const;
+
+  private:
+	[[nodiscard]] std::string getCachedPath(const std::string& key) const;
+	void removeOtherVersions() const;
+
+	std::string folder;
+	std::string versionPrefix;
+	bool usable;
+};
+
+} // namespace HoI4
+
+
+
+#endif // FLAG_CACHE_H
\ No newline at end of file
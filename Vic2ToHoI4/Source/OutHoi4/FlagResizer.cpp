@@ -0,0 +1,157 @@
+#include "FlagResizer.h"
+#include <algorithm>
+
+
+
+HoI4::FlagResizer::FlagResizer(const unsigned int width, const unsigned int height, const Filter filter):
+	 width(width), height(height), filter(filter), pixels(static_cast<size_t>(width) * height * 4)
+{
+}
+
+
+void HoI4::FlagResizer::resize(const uint8_t* const sourcePixels,
+	 const unsigned int sourceWidth,
+	 const unsigned int sourceHeight,
+	 const unsigned int sourceBytesPerPixel)
+{
+	updateTables(sourceWidth, sourceHeight, sourceBytesPerPixel);
+
+	if (filter == Filter::Box)
+	{
+		resizeBox(sourcePixels);
+	}
+	else
+	{
+		resizeNearestNeighbor(sourcePixels);
+	}
+}
+
+
+void HoI4::FlagResizer::updateTables(const unsigned int sourceWidth,
+	 const unsigned int sourceHeight,
+	 const unsigned int sourceBytesPerPixel)
+{
+	if ((sourceWidth == tableSourceWidth) && (sourceHeight == tableSourceHeight) &&
+		 (sourceBytesPerPixel == tableSourceBytesPerPixel))
+	{
+		return;
+	}
+	tableSourceWidth = sourceWidth;
+	tableSourceHeight = sourceHeight;
+	tableSourceBytesPerPixel = sourceBytesPerPixel;
+
+	const size_t rowBytes = static_cast<size_t>(sourceWidth) * sourceBytesPerPixel;
+	columnStarts.clear();
+	columnEnds.clear();
+	rowStarts.clear();
+	rowEnds.clear();
+	columnScales.clear();
+
+	if (filter == Filter::NearestNeighbor)
+	{
+		// these are the positions flags have always been sampled from, so nearest neighbor flags are unchanged
+		for (unsigned int x = 0; x < width; x++)
+		{
+			const auto sourceX = static_cast<size_t>(1.0 * x / width * sourceWidth);
+			columnStarts.push_back(sourceX * sourceBytesPerPixel);
+			columnEnds.push_back((sourceX + 1) * sourceBytesPerPixel);
+		}
+		for (unsigned int y = 0; y < height; y++)
+		{
+			const auto sourceY = static_cast<size_t>(1.0 * y / height * sourceHeight);
+			rowStarts.push_back(sourceY * rowBytes);
+			rowEnds.push_back((sourceY + 1) * rowBytes);
+		}
+		return;
+	}
+
+	// each destination pixel covers the source pixels from its own start up to the next one's, so every source pixel
+	// is counted exactly once. When enlarging, a destination pixel still reads the one source pixel it falls in.
+	for (unsigned int x = 0; x < width; x++)
+	{
+		const auto sourceStart = static_cast<size_t>(x) * sourceWidth / width;
+		const auto sourceEnd = std::max(static_cast<size_t>(x + 1) * sourceWidth / width, sourceStart + 1);
+		columnStarts.push_back(sourceStart * sourceBytesPerPixel);
+		columnEnds.push_back(sourceEnd * sourceBytesPerPixel);
+		columnScales.push_back(1.0F / static_cast<float>(sourceEnd - sourceStart));
+	}
+	for (unsigned int y = 0; y < height; y++)
+	{
+		const auto sourceStart = static_cast<size_t>(y) * sourceHeight / height;
+		const auto sourceEnd = std::max(static_cast<size_t>(y + 1) * sourceHeight / height, sourceStart + 1);
+		rowStarts.push_back(sourceStart * rowBytes);
+		rowEnds.push_back(sourceEnd * rowBytes);
+	}
+	rowSums.resize(rowBytes);
+}
+
+
+void HoI4::FlagResizer::resizeNearestNeighbor(const uint8_t* const sourcePixels)
+{
+	auto* destPixel = pixels.data();
+	for (const auto rowStart: rowStarts)
+	{
+		const auto* const sourceRow = sourcePixels + rowStart;
+		for (const auto columnStart: columnStarts)
+		{
+			const auto* const sourcePixel = sourceRow + columnStart;
+			destPixel[0] = sourcePixel[0];
+			destPixel[1] = sourcePixel[1];
+			destPixel[2] = sourcePixel[2];
+			destPixel[3] = 0xFF;
+			destPixel += 4;
+		}
+	}
+}
+
+
+void HoI4::FlagResizer::resizeBox(const uint8_t* const sourcePixels)
+{
+	const size_t rowBytes = static_cast<size_t>(tableSourceWidth) * tableSourceBytesPerPixel;
+	const auto bytesPerPixel = tableSourceBytesPerPixel;
+
+	// writing bytes could change anything as far as the compiler knows, so the tables are read through local pointers
+	// that it doesn't have to reload after every pixel
+	auto* const sums = rowSums.data();
+	const auto* const starts = columnStarts.data();
+	const auto* const ends = columnEnds.data();
+	const auto* const scales = columnScales.data();
+
+	auto* destPixel = pixels.data();
+	for (unsigned int y = 0; y < height; y++)
+	{
+		// Add up whole source rows first. This loop runs over plain arrays with nothing depending on the previous
+		// byte, so the compiler turns it into vector instructions.
+		std::fill(sums, sums + rowBytes, 0);
+		for (auto rowStart = rowStarts[y]; rowStart < rowEnds[y]; rowStart += rowBytes)
+		{
+			const auto* const sourceRow = sourcePixels + rowStart;
+			for (size_t i = 0; i < rowBytes; i++)
+			{
+				sums[i] += sourceRow[i];
+			}
+		}
+
+		const auto rowScale = 1.0F / static_cast<float>((rowEnds[y] - rowStarts[y]) / rowBytes);
+		for (unsigned int x = 0; x < width; x++)
+		{
+			uint32_t blue = 0;
+			uint32_t green = 0;
+			uint32_t red = 0;
+			for (auto columnStart = starts[x]; columnStart < ends[x]; columnStart += bytesPerPixel)
+			{
+				blue += sums[columnStart + 0];
+				green += sums[columnStart + 1];
+				red += sums[columnStart + 2];
+			}
+
+			// multiplying by the area's reciprocal saves three slow integer divisions per pixel
+			const auto scale = rowScale * scales[x];
+			destPixel[0] = static_cast<uint8_t>(static_cast<float>(blue) * scale + 0.5F);
+			destPixel[1] = static_cast<uint8_t>(static_cast<float>(green) * scale + 0.5F);
+			destPixel[2] = static_cast<uint8_t>(static_cast<float>(red) * scale + 0.5F);
+			destPixel[3] = 0xFF;
+			destPixel += 4;
+		}
+	}
+}
\ No newline at end of file
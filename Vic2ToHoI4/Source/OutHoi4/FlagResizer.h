@@ -0,0 +1,67 @@
+#ifndef FLAG_RESIZER_H
+#define FLAG_RESIZER_H
+
+
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+
+namespace HoI4
+{
+
+// Scales flag images to one fixed size, always producing four bytes per pixel with an opaque alpha. Where each
+// destination pixel reads from is worked out once per source size and kept in tables, so a resizer used for many
+// flags of the same size spends its time copying or adding bytes.
+class FlagResizer
+{
+  public:
+	enum class Filter
+	{
+		NearestNeighbor,
+		Box // averages every source pixel a destination pixel covers, which keeps detail in very small flags
+	};
+
+	FlagResizer(unsigned int width, unsigned int height, Filter filter);
+
+	// sourcePixels holds sourceHeight rows of sourceWidth pixels with three or four bytes each, the alpha ignored
+	void resize(const uint8_t* sourcePixels,
+		 unsigned int sourceWidth,
+		 unsigned int sourceHeight,
+		 unsigned int sourceBytesPerPixel);
+
+	[[nodiscard]] auto getWidth() const { return width; }
+	[[nodiscard]] auto getHeight() const { return height; }
+	[[nodiscard]] const auto& getPixels() const { return pixels; }
+
+  private:
+	void updateTables(unsigned int sourceWidth, unsigned int sourceHeight, unsigned int sourceBytesPerPixel);
+	void resizeNearestNeighbor(const uint8_t* sourcePixels);
+	void resizeBox(const uint8_t* sourcePixels);
+
+	unsigned int width;
+	unsigned int height;
+	Filter filter;
+	std::vector<uint8_t> pixels;
+
+	unsigned int tableSourceWidth = 0;
+	unsigned int tableSourceHeight = 0;
+	unsigned int tableSourceBytesPerPixel = 0;
+
+	// byte offsets into the source of the first column and row each destination pixel reads, and one past the last
+	std::vector<size_t> columnStarts;
+	std::vector<size_t> columnEnds;
+	std::vector<size_t> rowStarts;
+	std::vector<size_t> rowEnds;
+	std::vector<float> columnScales; // one over the number of source columns each destination column covers
+
+	std::vector<uint32_t> rowSums;
+};
+
+} // namespace HoI4
+
+
+
+#endif // FLAG_RESIZER_H
\ No newline at end of file
@@ -1,12 +1,12 @@
 #include "OutSupplyZone.h"
-#include <fstream>
+#include "OutHoi4/OutputFile.h"
 
 
 
 void HoI4::outputSupplyZone(const SupplyZone& supplyZone, const std::string& filename, const std::string& outputName)
 {
 	const auto fullFilename("output/" + outputName + "/map/supplyareas/" + filename);
-	std::ofstream out(fullFilename);
+	OutputFile out(fullFilename);
 	if (!out.is_open())
 	{
 		throw std::runtime_error("Could not open \"output/input/map/supplyareas/" + filename);
@@ -22,7 +22,7 @@ void HoI4::outputSupplyZone(const SupplyZone& supplyZone, const std::string& fil
 	{
 		out << stateNum << " ";
 	}
-	out << std::endl;
+	out << "\n";
 	out << "\t}\n";
 	out << "}\n";
 
@@ -1,28 +1,116 @@
 #include "OutFlags.h"
+#include "FlagCache.h"
+#include "FlagResizer.h"
 #include "HOI4World/HoI4Country.h"
 #include "Log.h"
 #include "OSCompatibilityLayer.h"
+#include "ParallelFor.h"
 #include "V2World/Countries/Country.h"
 #include "targa.h"
+#include <array>
+#include <memory>
 #include <optional>
 
 
 
+namespace
+{
+
+struct FlagSize
+{
+	unsigned int width;
+	unsigned int height;
+	HoI4::FlagResizer::Filter filter;
+	std::string_view folder;
+};
+
+// every flag is written once at each of these sizes, with the smallest averaged so its details don't drop out
+constexpr std::array<FlagSize, 3> flagSizes{{
+	 {82, 52, HoI4::FlagResizer::Filter::NearestNeighbor, "/gfx/flags/"},
+	 {41, 26, HoI4::FlagResizer::Filter::NearestNeighbor, "/gfx/flags/medium/"},
+	 {10, 7, HoI4::FlagResizer::Filter::Box, "/gfx/flags/small/"},
+}};
+
+
+struct FlagDeleter
+{
+	void operator()(tga_image* flag) const
+	{
+		tga_free_buffers(flag);
+		delete flag;
+	}
+};
+using DecodedFlag = std::unique_ptr<tga_image, FlagDeleter>;
+
+
+// kept between conversions, so batches of saves from one campaign only make each flag once
+constexpr auto flagCacheFolder = "flagCache";
+
+// cached flags are only reused while this matches, so raise it whenever the same source would make a different flag
+constexpr auto flagCacheVersion = 1;
+
+
+std::string getFlagCacheKey(const std::string& contentKey, const FlagSize& size)
+{
+	auto key = contentKey + "_" + std::to_string(size.width) + "x" + std::to_string(size.height);
+	if (size.filter == HoI4::FlagResizer::Filter::Box)
+	{
+		key += "_box";
+	}
+	return key;
+}
+
+
+std::vector<HoI4::FlagResizer> createFlagResizers()
+{
+	std::vector<HoI4::FlagResizer> resizers;
+	for (const auto& [width, height, filter, folder]: flagSizes)
+	{
+		resizers.emplace_back(width, height, filter);
+	}
+	return resizers;
+}
+
+
+// the resizer's pixels are only borrowed, so the image must not be given to tga_free_buffers
+tga_image createResizedFlag(const HoI4::FlagResizer& resizer)
+{
+	tga_image flag{};
+	flag.image_id_length = 0;
+	flag.color_map_type = TGA_COLOR_MAP_ABSENT;
+	flag.image_type = TGA_IMAGE_TYPE_BGR;
+	flag.color_map_origin = 0;
+	flag.color_map_length = 0;
+	flag.color_map_depth = 0;
+	flag.origin_x = 0;
+	flag.origin_y = 0;
+	flag.width = static_cast<uint16_t>(resizer.getWidth());
+	flag.height = static_cast<uint16_t>(resizer.getHeight());
+	flag.pixel_depth = 32;
+	flag.image_descriptor = 8;
+	flag.image_id = nullptr;
+	flag.color_map_data = nullptr;
+	flag.image_data = const_cast<uint8_t*>(resizer.getPixels().data());
+
+	return flag;
+}
+
+} // namespace
+
+
+
 namespace HoI4
 {
 
-void processFlagsForCountry(const std::pair<std::string, std::shared_ptr<Country>>& country,
+std::optional<std::string> processFlagsForCountry(const std::string& tag,
+	 const std::vector<std::string>& sourcePaths,
 	 const std::string& outputName,
-	 const std::vector<Vic2::Mod>& vic2Mods,
-	 const std::string& vic2ModPath);
+	 const std::optional<FlagCache>& flagCache);
 std::vector<std::string> getSourceFlagPaths(const std::string& Vic2Tag,
 	 const std::vector<Vic2::Mod>& vic2Mods,
 	 const std::string& vic2ModPath);
-std::optional<tga_image*> readFlag(const std::string& path);
-tga_image* createNewFlag(const tga_image* sourceFlag, unsigned int sizeX, unsigned int sizeY);
-void createBigFlag(const tga_image* sourceFlag, const std::string& filename, const std::string& outputName);
-void createMediumFlag(const tga_image* sourceFlag, const std::string& filename, const std::string& outputName);
-void createSmallFlag(const tga_image* sourceFlag, const std::string& filename, const std::string& outputName);
+DecodedFlag readFlag(const std::string& path, tga_result& result);
+void writeFlag(const tga_image& flag, const std::string& path);
 std::optional<std::string> getSourceFlagPath(const std::string& Vic2Tag,
 	 const std::string& sourceSuffix,
 	 const std::vector<Vic2::Mod>& vic2Mods,
@@ -42,7 +130,8 @@ std::optional<std::string> getAllowModFlags(const std::string& flagFilename,
 void HoI4::copyFlags(const std::map<std::string, std::shared_ptr<Country>>& countries,
 	 const std::string& outputName,
 	 const std::vector<Vic2::Mod>& vic2Mods,
-	 const std::string& vic2ModPath)
+	 const std::string& vic2ModPath,
+	 const Configuration& theConfiguration)
 {
 	Log(LogLevel::Info) << "\tCreating flags";
 
@@ -63,9 +152,29 @@ void HoI4::copyFlags(const std::map<std::string, std::shared_ptr<Country>>& coun
 		throw std::runtime_error("Could not create output/" + outputName + "/gfx/flags/small");
 	}
 
-	for (const auto& country: countries)
+	// looking for source flags logs warnings, so it's done up front to keep the log in country order
+	std::vector<std::pair<std::string, std::vector<std::string>>> flagSources;
+	for (const auto& [tag, country]: countries)
+	{
+		flagSources.emplace_back(tag, getSourceFlagPaths(country->getOldTag(), vic2Mods, vic2ModPath));
+	}
+
+	std::optional<FlagCache> flagCache;
+	if (theConfiguration.getCacheFlags())
 	{
-		processFlagsForCountry(country, outputName, vic2Mods, vic2ModPath);
+		flagCache.emplace(flagCacheFolder, flagCacheVersion);
+	}
+	std::vector<std::optional<std::string>> readErrors(flagSources.size());
+	forEachInParallel(flagSources.size(), theConfiguration.getNumberOfThreads(), [&](const size_t country) {
+		readErrors[country] =
+			 processFlagsForCountry(flagSources[country].first, flagSources[country].second, outputName, flagCache);
+	});
+	for (const auto& readError: readErrors)
+	{
+		if (readError)
+		{
+			Log(LogLevel::Warning) << *readError;
+		}
 	}
 }
 
@@ -91,30 +200,74 @@ const std::vector<std::string> hoi4Suffixes{
 static std::set<std::string> allowedMods = {"POPs of Darkness", "New Nations Mod", "Divergences of Darkness", "The Concert of Europe"};
 
 
-void HoI4::processFlagsForCountry(const std::pair<std::string, std::shared_ptr<Country>>& country,
+std::optional<std::string> HoI4::processFlagsForCountry(const std::string& tag,
+	 const std::vector<std::string>& sourcePaths,
 	 const std::string& outputName,
-	 const std::vector<Vic2::Mod>& vic2Mods,
-	 const std::string& vic2ModPath)
+	 const std::optional<FlagCache>& flagCache)
 {
-	const auto sourcePaths = getSourceFlagPaths(country.second->getOldTag(), vic2Mods, vic2ModPath);
+	// each thread keeps its resizers, and with them their buffers and sampling tables, from country to country
+	thread_local auto resizers = createFlagResizers();
+
+	// missing flags fall back to the base flag, so the same source is often used several times
+	std::string sourcePath;
+	std::optional<std::string> contentKey;
+	DecodedFlag sourceFlag;
 	for (size_t i = 0; i < sourcePaths.size(); i++)
 	{
-		if (!sourcePaths[i].empty())
+		if (sourcePaths[i].empty())
 		{
-			auto sourceFlag = readFlag(sourcePaths[i]);
-			if (!sourceFlag)
+			continue;
+		}
+		if (sourcePaths[i] != sourcePath)
+		{
+			sourcePath = sourcePaths[i];
+			if (flagCache)
+			{
+				contentKey = FlagCache::getContentKey(sourcePath);
+			}
+			sourceFlag.reset();
+		}
+
+		for (size_t size = 0; size < flagSizes.size(); size++)
+		{
+			const auto destination = "output/" + outputName + std::string(flagSizes[size].folder) + tag + hoi4Suffixes[i];
+			std::optional<std::string> cacheKey;
+			if (flagCache && contentKey)
 			{
-				return;
+				cacheKey = getFlagCacheKey(*contentKey, flagSizes[size]);
+				if (flagCache->copyCachedFlag(*cacheKey, destination))
+				{
+					continue;
+				}
 			}
 
-			createBigFlag(*sourceFlag, country.first + hoi4Suffixes[i], outputName);
-			createMediumFlag(*sourceFlag, country.first + hoi4Suffixes[i], outputName);
-			createSmallFlag(*sourceFlag, country.first + hoi4Suffixes[i], outputName);
+			// the source is only decoded once some size of it isn't already cached
+			if (!sourceFlag)
+			{
+				tga_result result;
+				sourceFlag = readFlag(sourcePath, result);
+				if (!sourceFlag)
+				{
+					return "Could not read flag " + sourcePath + ": " + tga_error(result) + ".";
+				}
+				for (auto& resizer: resizers)
+				{
+					resizer.resize(sourceFlag->image_data,
+						 sourceFlag->width,
+						 sourceFlag->height,
+						 sourceFlag->pixel_depth / 8);
+				}
+			}
 
-			tga_free_buffers(*sourceFlag);
-			delete *sourceFlag;
+			writeFlag(createResizedFlag(resizers[size]), destination);
+			if (cacheKey)
+			{
+				flagCache->addFlag(*cacheKey, destination);
+			}
 		}
 	}
+
+	return std::nullopt;
 }
 
 
@@ -238,119 +391,23 @@ std::optional<std::string> HoI4::getAllowModFlags(const std::string& flagFilenam
 }
 
 
-std::optional<tga_image*> HoI4::readFlag(const std::string& path)
+DecodedFlag HoI4::readFlag(const std::string& path, tga_result& result)
 {
-	auto flag = new tga_image;
-	const auto result = tga_read(flag, path.c_str());
+	DecodedFlag flag(new tga_image{});
+	result = tga_read(flag.get(), path.c_str());
 	if (result != TGA_NOERR)
 	{
-		Log(LogLevel::Warning) << "Could not read flag " << path << ": " << tga_error(result) << ".";
-		delete flag;
-		flag = {};
+		flag.reset();
 	}
 
 	return flag;
 }
 
 
-tga_image* HoI4::createNewFlag(const tga_image* const sourceFlag, const unsigned int sizeX, const unsigned int sizeY)
-{
-	const auto destFlag = new tga_image;
-	destFlag->image_id_length = 0;
-	destFlag->color_map_type = TGA_COLOR_MAP_ABSENT;
-	destFlag->image_type = TGA_IMAGE_TYPE_BGR;
-	destFlag->color_map_origin = 0;
-	destFlag->color_map_length = 0;
-	destFlag->color_map_depth = 0;
-	destFlag->origin_x = 0;
-	destFlag->origin_y = 0;
-	destFlag->width = sizeX;
-	destFlag->height = sizeY;
-	destFlag->pixel_depth = 32;
-	destFlag->image_descriptor = 8;
-	destFlag->image_id = nullptr;
-	destFlag->color_map_data = nullptr;
-
-	destFlag->image_data = static_cast<uint8_t*>(malloc(sizeX * sizeY * 4));
-	if (destFlag->image_data == nullptr)
-	{
-		return destFlag;
-	}
-	for (unsigned int y = 0; y < sizeY; y++)
-	{
-		for (unsigned int x = 0; x < sizeX; x++)
-		{
-			const auto sourceY = static_cast<int>(1.0 * y / sizeY * sourceFlag->height);
-			const auto sourceX = static_cast<int>(1.0 * x / sizeX * sourceFlag->width);
-			const auto sourceBytesPerPixel = sourceFlag->pixel_depth / 8;
-			const auto sourceIndex = (sourceY * sourceFlag->width + sourceX) * sourceBytesPerPixel;
-
-			const auto destIndex = (y * sizeX + x) * 4;
-
-			destFlag->image_data[destIndex + 0] = sourceFlag->image_data[sourceIndex + 0];
-			destFlag->image_data[destIndex + 1] = sourceFlag->image_data[sourceIndex + 1];
-			destFlag->image_data[destIndex + 2] = sourceFlag->image_data[sourceIndex + 2];
-			destFlag->image_data[destIndex + 3] = 0xFF;
-		}
-	}
-
-	return destFlag;
-}
-
-
-void HoI4::createBigFlag(const tga_image* const sourceFlag, const std::string& filename, const std::string& outputName)
-{
-	const auto destFlag = createNewFlag(sourceFlag, 82, 52);
-
-	const tga_result result = tga_write(("output/" + outputName + "/gfx/flags/" + filename).c_str(), destFlag);
-	if (result)
-	{
-		tga_free_buffers(destFlag);
-		delete destFlag;
-		throw std::runtime_error(
-			 "Could not create output/" + outputName + "/gfx/flags/" + filename + " : " + tga_error(result));
-	}
-
-	tga_free_buffers(destFlag);
-	delete destFlag;
-}
-
-
-void HoI4::createMediumFlag(const tga_image* const sourceFlag,
-	 const std::string& filename,
-	 const std::string& outputName)
-{
-	const auto destFlag = createNewFlag(sourceFlag, 41, 26);
-
-	const tga_result result = tga_write(("output/" + outputName + "/gfx/flags/medium/" + filename).c_str(), destFlag);
-	if (result)
-	{
-		tga_free_buffers(destFlag);
-		delete destFlag;
-		throw std::runtime_error(
-			 "Could not create output/" + outputName + "/gfx/flags/medium/" + filename + " : " + tga_error(result));
-	}
-
-	tga_free_buffers(destFlag);
-	delete destFlag;
-}
-
-
-void HoI4::createSmallFlag(const tga_image* const sourceFlag,
-	 const std::string& filename,
-	 const std::string& outputName)
+void HoI4::writeFlag(const tga_image& flag, const std::string& path)
 {
-	const auto destFlag = createNewFlag(sourceFlag, 10, 7);
-
-	const tga_result result = tga_write(("output/" + outputName + "/gfx/flags/small/" + filename).c_str(), destFlag);
-	if (result)
+	if (const auto result = tga_write(path.c_str(), &flag); result != TGA_NOERR)
 	{
-		tga_free_buffers(destFlag);
-		delete destFlag;
-		throw std::runtime_error(
-			 "Could not create output/" + outputName + "/gfx/flags/small/" + filename + " : " + tga_error(result));
+		throw std::runtime_error("Could not create " + path + " : " + tga_error(result));
 	}
-
-	tga_free_buffers(destFlag);
-	delete destFlag;
 }
\ No newline at end of file
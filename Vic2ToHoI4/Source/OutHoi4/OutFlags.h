@@ -3,6 +3,7 @@
 
 
 
+#include "Configuration.h"
 #include "HOI4World/HoI4Country.h"
 #include <map>
 #include <string>
@@ -16,7 +17,8 @@ namespace HoI4
 void copyFlags(const std::map<std::string, std::shared_ptr<Country>>& countries,
 	 const std::string& outputName,
 	 const std::vector<Vic2::Mod>& vic2Mods,
-	 const std::string& vic2vic2ModPathPath);
+	 const std::string& vic2vic2ModPathPath,
+	 const Configuration& theConfiguration);
 
 }
 
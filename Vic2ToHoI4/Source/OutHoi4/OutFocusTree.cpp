@@ -1,14 +1,14 @@
 #include "OutFocusTree.h"
 #include "OutFocus.h"
+#include "OutHoi4/OutputFile.h"
 #include "OutSharedFocus.h"
-#include <fstream>
 #include <string>
 
 
 
 void HoI4::outputFocusTree(const HoI4FocusTree& focusTree, const std::string& filename)
 {
-	std::ofstream out(filename);
+	OutputFile out(filename);
 	if (!out.is_open())
 	{
 		throw std::runtime_error("Could not create " + filename);
@@ -52,7 +52,7 @@ void HoI4::outputFocusTree(const HoI4FocusTree& focusTree, const std::string& fi
 
 void HoI4::outputSharedFocuses(const HoI4FocusTree& focusTree, const std::string& filename)
 {
-	std::ofstream SharedFocuses(filename);
+	OutputFile SharedFocuses(filename);
 	if (!SharedFocuses.is_open())
 	{
 		throw std::runtime_error("Could not create " + filename);
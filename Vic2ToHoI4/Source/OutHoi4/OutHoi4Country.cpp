@@ -229,25 +229,24 @@ void HoI4::outputPortraits(std::ostream& portraitsFile, const HoI4::Country& the
 }
 
 
-void outputHistory(const HoI4::Country& theCountry, const Configuration& theConfiguration);
+std::optional<std::string> outputHistory(const HoI4::Country& theCountry, const Configuration& theConfiguration);
 void outputOOB(const std::vector<HoI4::DivisionTemplateType>& divisionTemplates,
 	 const HoI4::Country& theCountry,
 	 const Configuration& theConfiguration);
-void outputCommonCountryFile(const HoI4::Country& theCountry, const Configuration& theConfiguration);
 void outputAdvisorIdeas(const std::string& tag,
 	 const std::set<HoI4::Advisor>& ideologicalAdvisors,
 	 const Configuration& theConfiguration);
 
-void HoI4::outputCountry(const std::set<Advisor>& ideologicalMinisters,
+std::optional<std::string> HoI4::outputCountry(const std::set<Advisor>& ideologicalMinisters,
 	 const std::vector<DivisionTemplateType>& divisionTemplates,
 	 const Country& theCountry,
 	 const Configuration& theConfiguration)
 {
+	std::optional<std::string> warning;
 	if (theCountry.getCapitalState())
 	{
-		outputHistory(theCountry, theConfiguration);
+		warning = outputHistory(theCountry, theConfiguration);
 		outputOOB(divisionTemplates, theCountry, theConfiguration);
-		outputCommonCountryFile(theCountry, theConfiguration);
 		outputAdvisorIdeas(theCountry.getTag(), ideologicalMinisters, theConfiguration);
 		outputAIStrategy(theCountry, theConfiguration.getOutputName());
 
@@ -258,6 +257,8 @@ void HoI4::outputCountry(const std::set<Advisor>& ideologicalMinisters,
 					  "_NF.txt");
 		}
 	}
+
+	return warning;
 }
 
 
@@ -285,7 +286,7 @@ void outputPolitics(std::ostream& output,
 void outputRelations(std::ostream& output,
 	 const std::string& tag,
 	 const std::map<std::string, HoI4::Relations>& relations);
-void outputFactions(std::ostream& output,
+std::optional<std::string> outputFactions(std::ostream& output,
 	 const std::string& tag,
 	 const std::optional<HoI4::Faction>& faction,
 	 const std::optional<std::string>& possibleLeaderName);
@@ -308,7 +309,7 @@ void outputCommanders(std::ostream& output,
 	 const std::vector<HoI4::Admiral>& admirals);
 
 
-void outputHistory(const HoI4::Country& theCountry, const Configuration& theConfiguration)
+std::optional<std::string> outputHistory(const HoI4::Country& theCountry, const Configuration& theConfiguration)
 {
 	const auto& tag = theCountry.getTag();
 	const auto& governmentIdeology = theCountry.getGovernmentIdeology();
@@ -348,7 +349,7 @@ void outputHistory(const HoI4::Country& theCountry, const Configuration& theConf
 		 theCountry.areElectionsAllowed(),
 		 theCountry.getIdeologySupport());
 	outputRelations(output, tag, theCountry.getRelations());
-	outputFactions(output, tag, theCountry.getFaction(), theCountry.getName());
+	const auto warning = outputFactions(output, tag, theCountry.getFaction(), theCountry.getName());
 	outputGuaranteedSpherelings(output, theCountry.getGuaranteed());
 	outputIdeas(output,
 		 theCountry.isGreatPower(),
@@ -374,6 +375,7 @@ void outputHistory(const HoI4::Country& theCountry, const Configuration& theConf
 	output << theCountry.getTheShipVariants();
 
 	output.close();
+	return warning;
 }
 
 
@@ -632,11 +634,12 @@ void outputRelations(std::ostream& output,
 }
 
 
-void outputFactions(std::ostream& output,
+std::optional<std::string> outputFactions(std::ostream& output,
 	 const std::string& tag,
 	 const std::optional<HoI4::Faction>& faction,
 	 const std::optional<std::string>& possibleLeaderName)
 {
+	std::optional<std::string> warning;
 	if (faction && (faction->getLeader()->getTag() == tag))
 	{
 		std::string allianceName;
@@ -646,7 +649,7 @@ void outputFactions(std::ostream& output,
 		}
 		else
 		{
-			Log(LogLevel::Warning) << "Could not name alliance";
+			warning = "Could not name alliance";
 			allianceName = "faction";
 		}
 		output << "create_faction = \"" + allianceName + "\"\n";
@@ -657,6 +660,7 @@ void outputFactions(std::ostream& output,
 	}
 
 	output << '\n';
+	return warning;
 }
 
 void outputGuaranteedSpherelings(std::ostream& output, const std::vector<std::string>& guaranteed)
@@ -873,7 +877,7 @@ void outputOOB(const std::vector<HoI4::DivisionTemplateType>& divisionTemplates,
 }
 
 
-void outputCommonCountryFile(const HoI4::Country& theCountry, const Configuration& theConfiguration)
+void HoI4::outputCommonCountryFile(const Country& theCountry, const Configuration& theConfiguration)
 {
 	const auto& commonCountryFile = theCountry.getCommonCountryFile();
 	std::ofstream output("output/" + theConfiguration.getOutputName() + "/common/countries/" +
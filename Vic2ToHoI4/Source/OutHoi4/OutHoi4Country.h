@@ -9,8 +9,10 @@
 #include "HOI4World/Military/DivisionTemplate.h"
 #include "HOI4World/Names/Names.h"
 #include "Mappers/Graphics/GraphicsMapper.h"
+#include <optional>
 #include <ostream>
 #include <set>
+#include <string>
 #include <vector>
 
 
@@ -24,11 +26,15 @@ void outputToNamesFiles(std::ostream& namesFile, const Names& names, const Count
 void outputToUnitNamesFiles(const Country& theCountry, const Configuration& theConfiguration);
 void outputIdeaGraphics(std::ostream& ideasFile, const Country& theCountry);
 void outputPortraits(std::ostream& portraitsFile, const Country& theCountry);
-void outputCountry(const std::set<Advisor>& ideologicalMinisters,
+// Countries are output in parallel, so a warning is returned to be logged by the caller
+[[nodiscard]] std::optional<std::string> outputCountry(const std::set<Advisor>& ideologicalMinisters,
 	 const std::vector<DivisionTemplateType>& divisionTemplates,
 	 const Country& theCountry,
 	 const Configuration& theConfiguration);
 
+// Named for the country's name rather than its tag, so countries with the same name share one of these files
+void outputCommonCountryFile(const Country& theCountry, const Configuration& theConfiguration);
+
 void reportIndustry(std::ostream& out, const Country& theCountry);
 
 } // namespace HoI4
@@ -20,6 +20,7 @@
 #include "OutHoi4Country.h"
 #include "OutLocalisation.h"
 #include "OutOnActions.h"
+#include "ParallelFor.h"
 #include "ScriptedEffects/OutScriptedEffects.h"
 #include "ScriptedLocalisations/OutScriptedLocalisations.h"
 #include "ScriptedTriggers/OutScriptedTriggers.h"
@@ -29,6 +30,7 @@
 #include <fstream>
 #include <iterator>
 #include <optional>
+#include <vector>
 #include "CountryCategories/OutCountryCategories.h"
 
 
@@ -41,6 +43,7 @@ void reportDefaultIndustry(const World& world);
 std::pair<std::string, std::array<int, 3>> getDefaultStateIndustry(const DefaultState& state);
 void reportDefaultIndustry(const std::map<std::string, std::array<int, 3>>& countriesIndustry);
 
+std::vector<const Country*> getCountriesWithCapitals(const std::map<std::string, std::shared_ptr<Country>>& countries);
 void outputCommonCountries(const std::map<std::string, std::shared_ptr<Country>>& countries,
 	 const std::string& outputName);
 void outputColorsFile(const std::map<std::string, std::shared_ptr<Country>>& countries, const std::string& outputName);
@@ -172,7 +175,7 @@ void HoI4::OutputWorld(const World& world,
 	outputNames(world.getNames(), world.getCountries(), outputName);
 	outputUnitNames(world.getCountries(), theConfiguration);
 	outputLocalisation(world.getLocalisation(), outputName);
-	outputStates(world.getTheStates(), outputName, debugEnabled);
+	outputStates(world.getTheStates(), outputName, debugEnabled, theConfiguration.getNumberOfThreads());
 	outputMap(world.getTheStates(), world.getStrategicRegions(), outputName);
 	outputSupplyZones(world.getSupplyZones(), outputName);
 	outputRelations(outputName);
@@ -207,6 +210,22 @@ void HoI4::OutputWorld(const World& world,
 }
 
 
+std::vector<const HoI4::Country*> HoI4::getCountriesWithCapitals(
+	 const std::map<std::string, std::shared_ptr<Country>>& countries)
+{
+	std::vector<const Country*> countriesWithCapitals;
+	for (const auto& country: countries)
+	{
+		if (country.second->getCapitalState())
+		{
+			countriesWithCapitals.push_back(country.second.get());
+		}
+	}
+
+	return countriesWithCapitals;
+}
+
+
 void HoI4::outputCommonCountries(const std::map<std::string, std::shared_ptr<Country>>& countries,
 	 const std::string& outputName)
 {
@@ -301,13 +320,13 @@ void HoI4::outputUnitNames(const std::map<std::string, std::shared_ptr<Country>>
 {
 	Log(LogLevel::Info) << "\t\tWriting unit names";
 
-	for (const auto& country: countries)
-	{
-		if (country.second->getCapitalState())
-		{
-			outputToUnitNamesFiles(*country.second, theConfiguration);
-		}
-	}
+	// each country's names go in files of their own, so countries can be written at the same time
+	const auto countriesWithCapitals = getCountriesWithCapitals(countries);
+	forEachInParallel(countriesWithCapitals.size(),
+		 theConfiguration.getNumberOfThreads(),
+		 [&countriesWithCapitals, &theConfiguration](const size_t country) {
+			 outputToUnitNamesFiles(*countriesWithCapitals[country], theConfiguration);
+		 });
 }
 
 
@@ -376,17 +395,28 @@ void HoI4::outputCountries(const std::set<Advisor>& activeIdeologicalAdvisors,
 		throw std::runtime_error("Could not create output/" + outputName + "/history/units");
 	}
 
-	for (const auto& country: countries)
+	// each country's history, units, and focus tree go in files named for its tag, so countries can be written at the
+	// same time. Files that countries can share are written afterwards, one at a time, with the last country winning.
+	const auto countriesWithCapitals = getCountriesWithCapitals(countries);
+	std::vector<std::optional<std::string>> countryWarnings(countriesWithCapitals.size());
+	forEachInParallel(countriesWithCapitals.size(), theConfiguration.getNumberOfThreads(), [&](const size_t country) {
+		const auto& specificMilitaryMappings = theMilitaryMappings.getMilitaryMappings(theConfiguration.getVic2Mods());
+		countryWarnings[country] = outputCountry(activeIdeologicalAdvisors,
+			 specificMilitaryMappings.getDivisionTemplates(),
+			 *countriesWithCapitals[country],
+			 theConfiguration);
+	});
+	for (const auto& countryWarning: countryWarnings)
 	{
-		if (country.second->getCapitalState())
+		if (countryWarning)
 		{
-			const auto& specificMilitaryMappings = theMilitaryMappings.getMilitaryMappings(theConfiguration.getVic2Mods());
-			outputCountry(activeIdeologicalAdvisors,
-				 specificMilitaryMappings.getDivisionTemplates(),
-				 *country.second,
-				 theConfiguration);
+			Log(LogLevel::Warning) << *countryWarning;
 		}
 	}
+	for (const auto* country: countriesWithCapitals)
+	{
+		outputCommonCountryFile(*country, theConfiguration);
+	}
 
 	std::ofstream ideasFile("output/" + outputName + "/interface/converter_ideas.gfx");
 	if (!ideasFile.is_open())
@@ -2,7 +2,7 @@
 #include "Configuration.h"
 #include "Log.h"
 #include "OSCompatibilityLayer.h"
-#include <fstream>
+#include "OutHoi4/OutputFile.h"
 
 
 
@@ -14,7 +14,7 @@ void outputLocalisations(const std::string& filenameStart, const HoI4::languageT
 		{
 			continue;
 		}
-		std::ofstream localisationFile(filenameStart + languageToLocalisations.first + ".yml", std::ios_base::app);
+		HoI4::OutputFile localisationFile(filenameStart + languageToLocalisations.first + ".yml", std::ios_base::app);
 		if (!localisationFile.is_open())
 		{
 			throw std::runtime_error("Could not update localisation text file");
@@ -24,7 +24,7 @@ void outputLocalisations(const std::string& filenameStart, const HoI4::languageT
 
 		for (const auto& mapping: languageToLocalisations.second)
 		{
-			localisationFile << " " << mapping.first << ":10 \"" << mapping.second << "\"" << std::endl;
+			localisationFile << " " << mapping.first << ":10 \"" << mapping.second << "\"\n";
 		}
 	}
 }
@@ -39,7 +39,7 @@ void outputStateLocalisations(const std::string& localisationPath,
 		{
 			continue;
 		}
-		std::ofstream localisationFile(localisationPath + "/state_names_l_" + languageToLocalisations.first + ".yml",
+		HoI4::OutputFile localisationFile(localisationPath + "/state_names_l_" + languageToLocalisations.first + ".yml",
 			 std::ios_base::app);
 		if (!localisationFile.is_open())
 		{
@@ -50,7 +50,7 @@ void outputStateLocalisations(const std::string& localisationPath,
 
 		for (const auto& mapping: languageToLocalisations.second)
 		{
-			localisationFile << " STATE_" << mapping.first << ":10 \"" << mapping.second << "\"" << std::endl;
+			localisationFile << " STATE_" << mapping.first << ":10 \"" << mapping.second << "\"\n";
 		}
 	}
 }
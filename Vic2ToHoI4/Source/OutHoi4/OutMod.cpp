@@ -39,7 +39,7 @@ void output(const HoI4::World& destWorld,
 
 	createOutputFolder(outputName);
 	createModFiles(outputName);
-	copyFlags(destWorld.getCountries(), outputName, vic2Mods, vic2ModPath);
+	copyFlags(destWorld.getCountries(), outputName, vic2Mods, vic2ModPath, theConfiguration);
 	OutputWorld(destWorld, outputName, debugEnabled, theConfiguration);
 }
 
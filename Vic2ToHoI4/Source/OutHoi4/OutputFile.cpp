@@ -0,0 +1,60 @@
+#include "OutputFile.h"
+
+
+
+HoI4::OutputFile::OutputFile(): std::ostream(nullptr)
+{
+	rdbuf(&buffer);
+}
+
+
+HoI4::OutputFile::OutputFile(const std::string& filename, const std::ios_base::openmode mode): OutputFile()
+{
+	open(filename, mode);
+}
+
+
+HoI4::OutputFile::~OutputFile()
+{
+	if (is_open())
+	{
+		close();
+	}
+}
+
+
+void HoI4::OutputFile::open(const std::string& filename, const std::ios_base::openmode mode)
+{
+	if (is_open())
+	{
+		close();
+	}
+
+	// the file is opened straight away, so a file that can't be written is found before anything is written to it
+	file.open(filename, mode | std::ios_base::out);
+	buffer.str("");
+	clear();
+	if (!file.is_open())
+	{
+		setstate(std::ios_base::failbit);
+	}
+}
+
+
+void HoI4::OutputFile::close()
+{
+	if (!file.is_open())
+	{
+		setstate(std::ios_base::failbit);
+		return;
+	}
+
+	const auto contents = buffer.view();
+	file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+	file.close();
+	if (!file)
+	{
+		setstate(std::ios_base::failbit);
+	}
+	buffer.str("");
+}
\ No newline at end of file
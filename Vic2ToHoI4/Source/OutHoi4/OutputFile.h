@@ -0,0 +1,41 @@
+#ifndef OUTPUT_FILE_H
+#define OUTPUT_FILE_H
+
+
+
+#include <fstream>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+
+
+namespace HoI4
+{
+
+// An output file stream that holds everything written to it in memory and writes it out in one go when it's closed,
+// instead of every few kilobytes as an ofstream does. That matters most when the output folder is on a network drive.
+// It can be used anywhere an ofstream is only written to.
+class OutputFile: public std::ostream
+{
+  public:
+	OutputFile();
+	explicit OutputFile(const std::string& filename, std::ios_base::openmode mode = std::ios_base::out);
+	~OutputFile() override;
+	OutputFile(const OutputFile&) = delete;
+	OutputFile& operator=(const OutputFile&) = delete;
+
+	void open(const std::string& filename, std::ios_base::openmode mode = std::ios_base::out);
+	[[nodiscard]] bool is_open() const { return file.is_open(); }
+	void close();
+
+  private:
+	std::stringbuf buffer{std::ios_base::out};
+	std::ofstream file;
+};
+
+} // namespace HoI4
+
+
+
+#endif // OUTPUT_FILE_H
\ No newline at end of file
@@ -1,12 +1,17 @@
 #include "OutHoI4States.h"
 #include "Log.h"
 #include "OSCompatibilityLayer.h"
+#include "OutHoi4/OutputFile.h"
 #include "OutHoI4State.h"
-#include <fstream>
+#include "ParallelFor.h"
+#include <vector>
 
 
 
-void HoI4::outputStates(const States& theStates, const std::string& outputName, const bool debugEnabled)
+void HoI4::outputStates(const States& theStates,
+	 const std::string& outputName,
+	 const bool debugEnabled,
+	 const unsigned int numThreads)
 {
 	Log(LogLevel::Info) << "\t\tWriting states";
 
@@ -14,20 +19,27 @@ void HoI4::outputStates(const States& theStates, const std::string& outputName,
 	{
 		throw std::runtime_error("Could not create \"output/" + outputName + "/history/states");
 	}
+
+	// every state has a file of its own, so they can all be written at once
+	std::vector<const std::pair<const int, State>*> states;
 	for (const auto& state: theStates.getStates())
 	{
-		auto filename("output/" + outputName + "/history/states/" + std::to_string(state.first) + ".txt");
-		std::ofstream out(filename);
+		states.push_back(&state);
+	}
+	forEachInParallel(states.size(), numThreads, [&states, &outputName, debugEnabled](const size_t index) {
+		const auto& [stateNum, state] = *states[index];
+		auto filename("output/" + outputName + "/history/states/" + std::to_string(stateNum) + ".txt");
+		OutputFile out(filename);
 		if (!out.is_open())
 		{
 			throw std::runtime_error("Could not open \"" + filename + "\"");
 		}
-		outputHoI4State(out, state.second, debugEnabled);
+		outputHoI4State(out, state, debugEnabled);
 		out.close();
-	}
+	});
 
 	auto filename("output/" + outputName + "/common/scripted_triggers/state_triggers_FR_loc.txt");
-	std::ofstream out(filename);
+	OutputFile out(filename);
 	if (!out.is_open())
 	{
 		throw std::runtime_error("Could not open \"" + filename + "\"");
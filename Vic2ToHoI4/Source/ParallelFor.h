@@ -0,0 +1,81 @@
+#ifndef PARALLEL_FOR_H
+#define PARALLEL_FOR_H
+
+
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+
+// Calls work(index) for every index below count, spread across requestedThreads threads (0 means every hardware
+// thread). Each thread takes the next index as soon as it is free, so uneven work still balances out. If any call
+// throws, or a thread can't be started, the remaining indexes are skipped and the exception that happened first is
+// rethrown once every started thread has stopped.
+template <typename Work>
+void forEachInParallel(const size_t count, const unsigned int requestedThreads, const Work& work)
+{
+	auto numThreads = static_cast<size_t>(requestedThreads);
+	if (numThreads == 0)
+	{
+		numThreads = std::thread::hardware_concurrency();
+	}
+	numThreads = std::clamp(numThreads, static_cast<size_t>(1), std::max(count, static_cast<size_t>(1)));
+
+	std::atomic<size_t> nextIndex = 0;
+	std::mutex errorMutex;
+	std::exception_ptr firstError;
+	const auto stopWithError = [&](std::exception_ptr error) {
+		nextIndex = count;
+		const std::scoped_lock lock(errorMutex);
+		if (!firstError)
+		{
+			firstError = std::move(error);
+		}
+	};
+	const auto workUntilDone = [&] {
+		try
+		{
+			for (auto index = nextIndex++; index < count; index = nextIndex++)
+			{
+				work(index);
+			}
+		}
+		catch (...)
+		{
+			stopWithError(std::current_exception());
+		}
+	};
+
+	std::vector<std::thread> threads;
+	try
+	{
+		for (size_t thread = 1; thread < numThreads; thread++)
+		{
+			threads.emplace_back(workUntilDone);
+		}
+	}
+	catch (...)
+	{
+		// the threads already started still have to be joined before the error can be passed on
+		stopWithError(std::current_exception());
+	}
+	workUntilDone();
+	for (auto& thread: threads)
+	{
+		thread.join();
+	}
+
+	if (firstError)
+	{
+		std::rethrow_exception(firstError);
+	}
+}
+
+
+
+#endif // PARALLEL_FOR_H
\ No newline at end of file
@@ -0,0 +1,64 @@
+#ifndef TAG_H_
+#define TAG_H_
+
+
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+
+
+// A three-character country tag packed into an integer, so tags can be copied, compared, and hashed without allocating
+// or comparing strings. Tags sort in the same order as their strings.
+class Tag
+{
+  public:
+	constexpr Tag() = default;
+
+	[[nodiscard]] static constexpr std::optional<Tag> parse(const std::string_view tagString)
+	{
+		if (tagString.size() != 3)
+		{
+			return std::nullopt;
+		}
+
+		Tag tag;
+		for (const auto character: tagString)
+		{
+			tag.packed = (tag.packed << 8U) | static_cast<unsigned char>(character);
+		}
+		return tag;
+	}
+
+	[[nodiscard]] std::string toString() const
+	{
+		return {static_cast<char>(packed >> 16U), static_cast<char>(packed >> 8U), static_cast<char>(packed)};
+	}
+
+	[[nodiscard]] constexpr std::uint32_t getPacked() const { return packed; }
+
+	constexpr auto operator<=>(const Tag&) const = default;
+
+  private:
+	std::uint32_t packed = 0;
+};
+
+
+inline std::ostream& operator<<(std::ostream& output, const Tag& tag)
+{
+	return output << tag.toString();
+}
+
+
+template <> struct std::hash<Tag>
+{
+	std::size_t operator()(const Tag& tag) const noexcept { return std::hash<std::uint32_t>{}(tag.getPacked()); }
+};
+
+
+
+#endif // TAG_H_
\ No newline at end of file
@@ -0,0 +1,64 @@
+#ifndef TAG_SET_H_
+#define TAG_SET_H_
+
+
+
+#include "Tag.h"
+#include <algorithm>
+#include <initializer_list>
+#include <string_view>
+#include <vector>
+
+
+
+// A set of tags kept as a sorted vector. The sets this is used for hold a handful of tags, so a binary search over
+// contiguous integers is faster and smaller than a tree of strings.
+class TagSet
+{
+  public:
+	TagSet() = default;
+	TagSet(const std::initializer_list<Tag> initialTags)
+	{
+		for (const auto tag: initialTags)
+		{
+			insert(tag);
+		}
+	}
+
+	void insert(const Tag tag)
+	{
+		if (const auto position = std::ranges::lower_bound(tags, tag); position == tags.end() || *position != tag)
+		{
+			tags.insert(position, tag);
+		}
+	}
+
+	void erase(const Tag tag)
+	{
+		if (const auto position = std::ranges::lower_bound(tags, tag); position != tags.end() && *position == tag)
+		{
+			tags.erase(position);
+		}
+	}
+
+	[[nodiscard]] bool contains(const Tag tag) const { return std::ranges::binary_search(tags, tag); }
+	[[nodiscard]] bool contains(const std::string_view tagString) const
+	{
+		const auto tag = Tag::parse(tagString);
+		return tag && contains(*tag);
+	}
+
+	[[nodiscard]] bool empty() const { return tags.empty(); }
+	[[nodiscard]] size_t size() const { return tags.size(); }
+	[[nodiscard]] auto begin() const { return tags.begin(); }
+	[[nodiscard]] auto end() const { return tags.end(); }
+
+	bool operator==(const TagSet&) const = default;
+
+  private:
+	std::vector<Tag> tags;
+};
+
+
+
+#endif // TAG_SET_H_
\ No newline at end of file
@@ -165,17 +165,11 @@ std::map<std::string, int> Vic2::Country::determineCultureSizes()
 {
 	std::map<std::string, int> cultureSizes;
 
-	for (auto [unused, province]: provinces)
+	for (const auto& [unused, province]: provinces)
 	{
-		for (const auto& pop: province->getPops())
+		for (const auto& [culture, population]: province->getPopulationByCulture())
 		{
-			const auto& popSize = pop.getSize();
-			const auto& popCulture = pop.getCulture();
-			auto [existing, inserted] = cultureSizes.insert(std::make_pair(popCulture, popSize));
-			if (!inserted)
-			{
-				existing->second += pop.getSize();
-			}
+			cultureSizes[culture] += population;
 		}
 	}
 
@@ -226,18 +220,14 @@ int32_t Vic2::Country::getEmployedWorkers() const
 }
 
 
-float Vic2::Country::getAverageIssueSupport(const std::string& issueName) const
+float Vic2::Country::getAverageIssueSupport(const unsigned int issueNumber) const
 {
 	float totalPopulation = 0.0;
 	float totalSupport = 0.0;
 	for (const auto& [unused, province]: provinces)
 	{
-		for (const auto& pop: province->getPops())
-		{
-			const auto size = static_cast<float>(pop.getSize());
-			totalSupport += pop.getIssueSupport(issueName) * size;
-			totalPopulation += size;
-		}
+		totalSupport += province->getPopulationWeightedIssueSupport(issueNumber);
+		totalPopulation += static_cast<float>(province->getTotalPopulation());
 	}
 
 	if (totalPopulation == 0.0F)
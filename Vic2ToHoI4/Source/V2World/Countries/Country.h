@@ -100,7 +100,7 @@ class Country
 
 	[[nodiscard]] bool hasCoreOnCapital() const;
 	[[nodiscard]] int32_t getEmployedWorkers() const;
-	[[nodiscard]] float getAverageIssueSupport(const std::string& issueName) const;
+	[[nodiscard]] float getAverageIssueSupport(unsigned int issueNumber) const;
 	[[nodiscard]] std::optional<std::string> getName(const std::string& language) const;
 	[[nodiscard]] std::optional<std::string> getAdjective(const std::string& language) const;
 	[[nodiscard]] std::vector<std::string> getShipNames(const std::string& category) const;
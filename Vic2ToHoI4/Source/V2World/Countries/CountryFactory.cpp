@@ -1,10 +1,10 @@
 #include "CountryFactory.h"
 #include "CommonRegexes.h"
-#include "Log.h"
 #include "ParserHelpers.h"
 #include "StringUtils.h"
 #include "V2World/Culture/CultureGroupsFactory.h"
 #include "V2World/Military/Leaders/TraitsFactory.h"
+#include "V2World/ParseWarning.h"
 #include "V2World/Technology/InventionsFactory.h"
 #include <cmath>
 #include <sstream>
@@ -12,12 +12,23 @@
 
 
 Vic2::Country::Factory::Factory(const Configuration& theConfiguration,
+	 const StateDefinitions& theStateDefinitions,
+	 std::shared_ptr<CultureGroups> theCultureGroups_):
+	 Factory(Inventions::Factory().loadInventions(theConfiguration),
+		  Traits::Factory().loadTraits(theConfiguration.getVic2Path()),
+		  theStateDefinitions,
+		  std::move(theCultureGroups_))
+{
+}
+
+
+Vic2::Country::Factory::Factory(std::shared_ptr<const Inventions> theInventions_,
+	 std::shared_ptr<const Traits> theTraits,
 	 const StateDefinitions& theStateDefinitions,
 	 std::shared_ptr<CultureGroups> theCultureGroups_):
 	 theCultureGroups(std::move(theCultureGroups_)),
-	 theInventions(Inventions::Factory().loadInventions(theConfiguration)),
-	 leaderFactory(
-		  std::make_unique<Leader::Factory>(std::move(*Traits::Factory().loadTraits(theConfiguration.getVic2Path())))),
+	 theInventions(std::move(theInventions_)),
+	 leaderFactory(std::make_unique<Leader::Factory>(std::move(theTraits))),
 	 stateFactory(std::make_unique<State::Factory>())
 {
 	registerKeyword("capital", [this](std::istream& theStream) {
@@ -109,7 +120,7 @@ Vic2::Country::Factory::Factory(const Configuration& theConfiguration,
 			}
 			catch (...)
 			{
-				Log(LogLevel::Warning) << "Malformed input while importing upper house composition for " << country->tag;
+				ParseWarning() << "Malformed input while importing upper house composition for " << country->tag;
 			}
 		}
 	});
@@ -190,13 +201,13 @@ void Vic2::Country::Factory::setParties(const std::vector<Party>& allParties)
 		}
 		else
 		{
-			Log(LogLevel::Warning) << "Party ID mismatch! Did some Vic2 country files not get read?";
+			ParseWarning() << "Party ID mismatch! Did some Vic2 country files not get read?";
 		}
 	}
 
 	if (rulingPartyID == 0)
 	{
-		LOG(LogLevel::Warning) << country->tag << " had no ruling party. The save may need manual repair.";
+		ParseWarning() << country->tag << " had no ruling party. The save may need manual repair.";
 	}
 	else if (rulingPartyID > allParties.size())
 	{
@@ -256,7 +267,7 @@ void Vic2::Country::Factory::setStateLanguageCategories(const StateLanguageCateg
 		}
 		else
 		{
-			Log(LogLevel::Warning) << state.getStateID() << " was not in any language category.";
+			ParseWarning() << state.getStateID() << " was not in any language category.";
 		}
 	}
 }
\ No newline at end of file
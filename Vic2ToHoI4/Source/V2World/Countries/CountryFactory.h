@@ -13,6 +13,7 @@
 #include "V2World/EU4ToVic2Data/CountryData.h"
 #include "V2World/Military/ArmyFactory.h"
 #include "V2World/Military/Leaders/LeaderFactory.h"
+#include "V2World/Military/Leaders/Traits.h"
 #include "V2World/States/StateFactory.h"
 #include "V2World/States/StateLanguageCategories.h"
 #include "V2World/Stockpiles/StockpileFactory.h"
@@ -32,6 +33,10 @@ class Country::Factory: commonItems::parser
 	Factory(const Configuration& theConfiguration,
 		 const StateDefinitions& theStateDefinitions,
 		 std::shared_ptr<CultureGroups> theCultureGroups_);
+	Factory(std::shared_ptr<const Inventions> theInventions_,
+		 std::shared_ptr<const Traits> theTraits,
+		 const StateDefinitions& theStateDefinitions,
+		 std::shared_ptr<CultureGroups> theCultureGroups_);
 	std::unique_ptr<Country> createCountry(const std::string& theTag,
 		 std::istream& theStream,
 		 const CommonCountryData& commonCountryData,
@@ -46,7 +51,7 @@ class Country::Factory: commonItems::parser
 	void setStateLanguageCategories(const StateLanguageCategories& stateLanguageCategories);
 
 	std::shared_ptr<CultureGroups> theCultureGroups;
-	std::unique_ptr<Inventions> theInventions;
+	std::shared_ptr<const Inventions> theInventions;
 	Relations::Factory relationsFactory;
 	Army::Factory armyFactory;
 	std::unique_ptr<Leader::Factory> leaderFactory;
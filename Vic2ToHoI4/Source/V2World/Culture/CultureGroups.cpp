@@ -6,10 +6,78 @@
 
 std::optional<std::string> Vic2::CultureGroups::getGroup(const std::string& culture) const
 {
-	if (!mappings.contains(culture))
+	const auto cultureId = cultureIds.find(culture);
+	if (cultureId == cultureIds.end())
 	{
 		return std::nullopt;
 	}
 
-	return mappings.at(culture);
+	const auto& groupId = cultureGroupIds[cultureId->second];
+	if (!groupId)
+	{
+		return std::nullopt;
+	}
+
+	return groupNames[*groupId];
+}
+
+
+std::optional<unsigned int> Vic2::CultureGroups::getCultureId(const std::string& culture) const
+{
+	const auto cultureId = cultureIds.find(culture);
+	if (cultureId == cultureIds.end())
+	{
+		return std::nullopt;
+	}
+
+	return cultureId->second;
+}
+
+
+unsigned int Vic2::CultureGroups::addCulture(const std::string& culture)
+{
+	const auto [cultureId, inserted] = cultureIds.emplace(culture, static_cast<unsigned int>(cultureGroupIds.size()));
+	if (inserted)
+	{
+		cultureGroupIds.emplace_back(std::nullopt);
+	}
+
+	return cultureId->second;
+}
+
+
+Vic2::CultureSet Vic2::CultureGroups::addCultures(const std::set<std::string>& cultures)
+{
+	CultureSet cultureSet;
+	for (const auto& culture: cultures)
+	{
+		cultureSet.insert(addCulture(culture));
+	}
+
+	return cultureSet;
+}
+
+
+void Vic2::CultureGroups::addCultureToGroup(const std::string& culture, const std::string& group)
+{
+	// groups are read one at a time, so a group can only be the most recent one
+	if (groupNames.empty() || groupNames.back() != group)
+	{
+		groupNames.push_back(group);
+	}
+
+	// a culture listed in more than one group stays in the first
+	const auto cultureId = addCulture(culture);
+	if (!cultureGroupIds[cultureId])
+	{
+		cultureGroupIds[cultureId] = static_cast<unsigned int>(groupNames.size() - 1);
+	}
+}
+
+
+void Vic2::CultureGroups::clear()
+{
+	cultureIds.clear();
+	cultureGroupIds.clear();
+	groupNames.clear();
 }
\ No newline at end of file
@@ -3,24 +3,39 @@
 
 
 
+#include "CultureSet.h"
 #include <map>
 #include <optional>
+#include <set>
 #include <string>
+#include <vector>
 
 
 
 namespace Vic2
 {
 
+// Every culture gets a dense ID, so that sets of cultures can be bitsets and a culture's group is one array lookup
 class CultureGroups
 {
   public:
 	class Factory;
 
 	[[nodiscard]] std::optional<std::string> getGroup(const std::string& culture) const;
+	[[nodiscard]] std::optional<unsigned int> getCultureId(const std::string& culture) const;
+	[[nodiscard]] auto getNumberOfCultures() const { return cultureGroupIds.size(); }
+
+	// Saves can use cultures that aren't in any group. They get IDs too, but have no group.
+	unsigned int addCulture(const std::string& culture);
+	CultureSet addCultures(const std::set<std::string>& cultures);
 
   private:
-	std::map<std::string, std::string> mappings;
+	void addCultureToGroup(const std::string& culture, const std::string& group);
+	void clear();
+
+	std::map<std::string, unsigned int> cultureIds;
+	std::vector<std::optional<unsigned int>> cultureGroupIds; // by culture ID
+	std::vector<std::string> groupNames;
 };
 
 } // namespace Vic2
@@ -10,7 +10,7 @@ Vic2::CultureGroups::Factory::Factory()
 	registerRegex(commonItems::catchallRegex, [this](const std::string& groupName, std::istream& theStream) {
 		for (const auto& culture: cultureGroupFactory.getCultureGroup(theStream))
 		{
-			cultureGroups->mappings.insert(make_pair(culture, groupName));
+			cultureGroups->addCultureToGroup(culture, groupName);
 		}
 	});
 }
@@ -30,7 +30,7 @@ std::unique_ptr<Vic2::CultureGroups> Vic2::CultureGroups::Factory::getCultureGro
 				  theConfiguration.getVic2ModPath() + "/" + mod.getDirectory() + "/common/cultures.txt"))
 		{
 			Log(LogLevel::Info) << "\tReading mod cultures from " << mod.getName();
-			cultureGroups->mappings.clear();
+			cultureGroups->clear();
 			parseFile(theConfiguration.getVic2ModPath() + "/" + mod.getDirectory() + "/common/cultures.txt");
 		}
 	}
@@ -0,0 +1,39 @@
+#ifndef CULTURE_SET_H
+#define CULTURE_SET_H
+
+
+
+#include <vector>
+
+
+
+namespace Vic2
+{
+
+// A set of cultures by their IDs from CultureGroups, kept as one bit per culture
+class CultureSet
+{
+  public:
+	void insert(const unsigned int cultureId)
+	{
+		if (cultureId >= cultures.size())
+		{
+			cultures.resize(cultureId + 1);
+		}
+		cultures[cultureId] = true;
+	}
+
+	[[nodiscard]] bool contains(const unsigned int cultureId) const
+	{
+		return cultureId < cultures.size() && cultures[cultureId];
+	}
+
+  private:
+	std::vector<bool> cultures;
+};
+
+} // namespace Vic2
+
+
+
+#endif // CULTURE_SET_H
\ No newline at end of file
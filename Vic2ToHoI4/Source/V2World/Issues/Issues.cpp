@@ -1,13 +1,26 @@
 #include "Issues.h"
+#include <algorithm>
 
 
 
 std::string Vic2::Issues::getIssueName(const unsigned int num) const
 {
-	if (num > issueNames.size() || num < 1)
+	if (!isValidIssueNumber(num))
 	{
 		return "";
 	}
 
 	return issueNames[num - 1];
+}
+
+
+std::optional<unsigned int> Vic2::Issues::getIssueNumber(const std::string& issueName) const
+{
+	const auto issue = std::ranges::find(issueNames, issueName);
+	if (issue == issueNames.end())
+	{
+		return std::nullopt;
+	}
+
+	return static_cast<unsigned int>(issue - issueNames.begin()) + 1;
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 
 
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -19,6 +20,8 @@ class Issues
 	Issues() = default;
 
 	[[nodiscard]] std::string getIssueName(unsigned int num) const;
+	[[nodiscard]] std::optional<unsigned int> getIssueNumber(const std::string& issueName) const;
+	[[nodiscard]] bool isValidIssueNumber(unsigned int num) const { return num >= 1 && num <= issueNames.size(); }
 
   private:
 	std::vector<std::string> issueNames;
@@ -2,124 +2,207 @@
 #include "Configuration.h"
 #include "Log.h"
 #include "OSCompatibilityLayer.h"
+#include "ParallelFor.h"
+#include <algorithm>
 #include <array>
 #include <fstream>
 
 
 
+namespace
+{
+
+// the code page each language is written in, in the same order as the languages
+constexpr std::array<Vic2::Encoding, Vic2::localisationLanguages.size()> languageEncodings{Vic2::Encoding::Win1252,
+	 Vic2::Encoding::Win1252,
+	 Vic2::Encoding::Win1252,
+	 Vic2::Encoding::Win1250,
+	 Vic2::Encoding::Win1252,
+	 Vic2::Encoding::Win1252,
+	 Vic2::Encoding::Win1250,
+	 Vic2::Encoding::Win1250,
+	 Vic2::Encoding::Win1250,
+	 Vic2::Encoding::Win1252,
+	 Vic2::Encoding::Win1252,
+	 Vic2::Encoding::Win1251,
+	 Vic2::Encoding::Win1252};
+
+
+// splits a line into its key and the text in each language, leaving any missing fields empty
+auto splitLine(std::string_view line)
+{
+	std::array<std::string_view, Vic2::localisationLanguages.size() + 1> fields;
+	for (auto& field: fields)
+	{
+		const auto division = line.find(';');
+		field = line.substr(0, division);
+		if (division == std::string_view::npos)
+		{
+			break;
+		}
+		line.remove_prefix(division + 1);
+	}
+
+	return fields;
+}
+
+
+bool isAscii(const std::string_view text)
+{
+	return std::ranges::all_of(text, [](const char character) {
+		return static_cast<unsigned char>(character) < 0x80;
+	});
+}
+
+} // namespace
+
+
+
 std::unique_ptr<Vic2::Localisations> Vic2::Localisations::Factory::importLocalisations(
 	 const Configuration& theConfiguration)
 {
 	Log(LogLevel::Info) << "Reading Vic2 localisation";
+	fileNames.clear();
 
-	ReadFromAllFilesInFolder(theConfiguration.getVic2Path() + "/localisation");
+	addAllFilesInFolder(theConfiguration.getVic2Path() + "/localisation");
 
 	for (const auto& mod: theConfiguration.getVic2Mods())
 	{
 		Log(LogLevel::Info) << "\tReading mod localisation";
-		ReadFromAllFilesInFolder(theConfiguration.getVic2ModPath() + "/" + mod.getDirectory() + "/localisation");
+		addAllFilesInFolder(theConfiguration.getVic2ModPath() + "/" + mod.getDirectory() + "/localisation");
 	}
 
 	if (commonItems::DoesFileExist("Configurables/Vic2Localisations.csv"))
 	{
-		ReadFromFile("Configurables/Vic2Localisations.csv");
+		fileNames.emplace_back("Configurables/Vic2Localisations.csv");
+	}
+
+	// files are read at the same time, then merged in order so that later files still override earlier ones
+	std::vector<Localisations> fileLocalisations(fileNames.size());
+	forEachInParallel(fileNames.size(), theConfiguration.getNumberOfThreads(), [this, &fileLocalisations](size_t file) {
+		ReadFromFile(fileNames[file], fileLocalisations[file]);
+	});
+
+	localisations = std::make_unique<Localisations>();
+	for (auto& localisationsInFile: fileLocalisations)
+	{
+		mergeLocalisations(localisationsInFile);
 	}
 
-	return std::make_unique<Localisations>(localisations, localisationToKeyMap);
+	return std::move(localisations);
 }
 
 
-void Vic2::Localisations::Factory::ReadFromAllFilesInFolder(const std::string& folderPath)
+void Vic2::Localisations::Factory::addAllFilesInFolder(const std::string& folderPath)
 {
 	for (const auto& fileName: commonItems::GetAllFilesInFolder(folderPath))
 	{
-		ReadFromFile(folderPath + '/' + fileName);
+		fileNames.push_back(folderPath + '/' + fileName);
 	}
 }
 
 
-void Vic2::Localisations::Factory::ReadFromFile(const std::string& fileName)
+void Vic2::Localisations::Factory::ReadFromFile(const std::string& fileName, Localisations& fileLocalisations)
 {
-	std::ifstream in(fileName);
+	// read the whole file at once and hand out each line and field as a view into it
+	std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+	if (!file.is_open())
+	{
+		return;
+	}
+	std::string contents(static_cast<size_t>(file.tellg()), '\0');
+	file.seekg(0);
+	file.read(contents.data(), static_cast<std::streamsize>(contents.size()));
+	contents.resize(static_cast<size_t>(file.gcount()));
 
-	while (!in.eof())
+	std::string_view remainingText(contents);
+	while (!remainingText.empty())
 	{
-		std::string line;
-		getline(in, line);
-		if (line[0] != '#')
+		const auto lineEnd = remainingText.find('\n');
+		auto line = remainingText.substr(0, lineEnd);
+		remainingText.remove_prefix((lineEnd == std::string_view::npos) ? remainingText.size() : lineEnd + 1);
+
+		if (line.ends_with('\r'))
 		{
-			processLine(line);
+			line.remove_suffix(1);
+		}
+		if (!line.empty() && (line[0] != '#'))
+		{
+			processLine(line, fileLocalisations);
 		}
 	}
-
-	in.close();
 }
 
 
-constexpr std::array<std::pair<const char*, Vic2::Encoding>, 13> languages = {{
-	 {"english", Vic2::Encoding::Win1252},
-	 {"french", Vic2::Encoding::Win1252},
-	 {"german", Vic2::Encoding::Win1252},
-	 {"polish", Vic2::Encoding::Win1250},
-	 {"spanish", Vic2::Encoding::Win1252},
-	 {"italian", Vic2::Encoding::Win1252},
-	 {"swedish", Vic2::Encoding::Win1250},
-	 {"czech", Vic2::Encoding::Win1250},
-	 {"hungarian", Vic2::Encoding::Win1250},
-	 {"dutch", Vic2::Encoding::Win1252},
-	 {"braz_por", Vic2::Encoding::Win1252},
-	 {"russian", Vic2::Encoding::Win1251},
-	 {"finnish", Vic2::Encoding::Win1252},
-}};
-void Vic2::Localisations::Factory::processLine(const std::string& line)
+void Vic2::Localisations::Factory::processLine(const std::string_view line, Localisations& fileLocalisations)
 {
-	auto division = line.find_first_of(';');
-	const auto key = line.substr(0, division);
+	const auto fields = splitLine(line);
+	const auto row = fileLocalisations.getOrAddRow(std::string(fields[0]));
 
-	for (const auto& [language, encoding]: languages)
+	for (size_t language = 0; language < localisationLanguages.size(); language++)
 	{
-		auto [rawLocalisation, newDivision] = extractNextLocalisation(line, division);
-		division = newDivision;
+		// plain ASCII reads the same in every code page, so only other text needs converting
+		const auto rawLocalisation = fields[language + 1];
+		auto UTF8Result = isAscii(rawLocalisation) ? std::string(rawLocalisation)
+																 : convertToUtf8(rawLocalisation, languageEncodings[language]);
 
-		auto UTF8Result = convertToUtf8(rawLocalisation, encoding);
-
-		if (strcmp(language, "english") == 0)
-		{
-			localisationToKeyMap[UTF8Result] = key;
-		}
-
-		if (!UTF8Result.empty())
+		if (language == 0)
 		{
-			localisations[key][language] = UTF8Result;
-		}
-		else if (strcmp(language, "english") != 0)
-		{
-			localisations[key][language] = localisations[key]["english"];
+			fileLocalisations.englishTextToRowMap.insert_or_assign(UTF8Result, row);
 		}
+		setText(fileLocalisations.textColumns[language][row], language, std::move(UTF8Result));
 	}
 }
 
 
-std::tuple<std::string, size_t> Vic2::Localisations::Factory::extractNextLocalisation(const std::string& line,
-	 size_t division)
+std::string Vic2::Localisations::Factory::convertToUtf8(const std::string_view rawLocalisation, Encoding encoding)
 {
-	const auto frontDivision = division + 1;
-	division = line.find_first_of(';', frontDivision);
-	return {line.substr(frontDivision, division - frontDivision), division};
+	if (encoding == Encoding::Win1250)
+	{
+		return commonItems::convertWin1250ToUTF8(std::string(rawLocalisation));
+	}
+	if (encoding == Encoding::Win1251)
+	{
+		return commonItems::convertWin1251ToUTF8(std::string(rawLocalisation));
+	}
+
+	// if (encoding == Encoding::Win1252)
+	return commonItems::convertWin1252ToUTF8(std::string(rawLocalisation));
 }
 
 
-std::string Vic2::Localisations::Factory::convertToUtf8(const std::string& rawLocalisation, Encoding encoding)
+void Vic2::Localisations::Factory::setText(std::optional<std::string>& text,
+	 const size_t language,
+	 std::string newText)
 {
-	if (encoding == Encoding::Win1250)
+	// English text that is missing leaves any earlier text in place, other languages fall back to English
+	if ((language == 0) && newText.empty() && text)
 	{
-		return commonItems::convertWin1250ToUTF8(rawLocalisation);
+		return;
 	}
-	if (encoding == Encoding::Win1251)
+
+	text = std::move(newText);
+}
+
+
+void Vic2::Localisations::Factory::mergeLocalisations(Localisations& fileLocalisations)
+{
+	std::vector<size_t> fileRowToRow(fileLocalisations.keyToRowMap.size());
+	for (const auto& [key, fileRow]: fileLocalisations.keyToRowMap)
 	{
-		return commonItems::convertWin1251ToUTF8(rawLocalisation);
+		const auto row = localisations->getOrAddRow(key);
+		fileRowToRow[fileRow] = row;
+		for (size_t language = 0; language < localisationLanguages.size(); language++)
+		{
+			if (auto& text = fileLocalisations.textColumns[language][fileRow]; text)
+			{
+				setText(localisations->textColumns[language][row], language, std::move(*text));
+			}
+		}
 	}
 
-	// if (encoding == Encoding::Win1252)
-	return commonItems::convertWin1252ToUTF8(rawLocalisation);
+	for (const auto& [englishText, fileRow]: fileLocalisations.englishTextToRowMap)
+	{
+		localisations->englishTextToRowMap.insert_or_assign(englishText, fileRowToRow[fileRow]);
+	}
 }
\ No newline at end of file
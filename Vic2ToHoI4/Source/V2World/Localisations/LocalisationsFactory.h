@@ -5,6 +5,11 @@
 
 #include "Configuration.h"
 #include "Vic2Localisations.h"
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
 
 
 
@@ -25,14 +30,15 @@ class Localisations::Factory
 	std::unique_ptr<Localisations> importLocalisations(const Configuration& theConfiguration);
 
   private:
-	void ReadFromAllFilesInFolder(const std::string& folderPath);
-	void ReadFromFile(const std::string& fileName);
-	void processLine(const std::string& line);
-	static std::tuple<std::string, size_t> extractNextLocalisation(const std::string& line, size_t division);
-	static std::string convertToUtf8(const std::string& rawLocalisation, Encoding encoding);
-
-	KeyToLocalisationsMap localisations;
-	std::map<std::string, std::string> localisationToKeyMap;
+	void addAllFilesInFolder(const std::string& folderPath);
+	static void ReadFromFile(const std::string& fileName, Localisations& fileLocalisations);
+	static void processLine(std::string_view line, Localisations& fileLocalisations);
+	static std::string convertToUtf8(std::string_view rawLocalisation, Encoding encoding);
+	static void setText(std::optional<std::string>& text, size_t language, std::string newText);
+	void mergeLocalisations(Localisations& fileLocalisations);
+
+	std::vector<std::string> fileNames; // later files override earlier ones
+	std::unique_ptr<Localisations> localisations;
 };
 
 } // namespace Vic2
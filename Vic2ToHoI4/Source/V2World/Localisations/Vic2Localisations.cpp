@@ -1,64 +1,152 @@
 #include "Vic2Localisations.h"
 #include "Log.h"
+#include <algorithm>
 #include <regex>
 
 
 
+namespace
+{
+
+std::optional<size_t> getLanguageIndex(const std::string_view language)
+{
+	const auto match = std::ranges::find(Vic2::localisationLanguages, language);
+	if (match == Vic2::localisationLanguages.end())
+	{
+		return std::nullopt;
+	}
+
+	return static_cast<size_t>(match - Vic2::localisationLanguages.begin());
+}
+
+} // namespace
+
+
+
+Vic2::Localisations::Localisations(const KeyToLocalisationsMap& _localisations,
+	 const std::map<std::string, std::string>& _localisationToKeyMap)
+{
+	for (const auto& [key, textInLanguages]: _localisations)
+	{
+		const auto row = getOrAddRow(key);
+		for (const auto& [language, text]: textInLanguages)
+		{
+			if (const auto languageIndex = getLanguageIndex(language); languageIndex)
+			{
+				textColumns[*languageIndex][row] = text;
+			}
+		}
+	}
+
+	for (const auto& [text, key]: _localisationToKeyMap)
+	{
+		if (const auto row = keyToRowMap.find(key); row != keyToRowMap.end())
+		{
+			englishTextToRowMap.insert(std::make_pair(text, row->second));
+		}
+	}
+}
+
+
 std::optional<std::string> Vic2::Localisations::getTextInLanguage(const std::string& key,
 	 const std::string& language) const
 {
-	const auto KeyToLocalisationsMapping = localisations.find(key);
-	if (KeyToLocalisationsMapping == localisations.end())
+	const auto row = keyToRowMap.find(key);
+	if (row == keyToRowMap.end())
 	{
 		return std::nullopt;
 	}
 
-	const auto LanguageToLocalisationMapping = KeyToLocalisationsMapping->second.find(language);
-	if (LanguageToLocalisationMapping == KeyToLocalisationsMapping->second.end())
+	const auto languageIndex = getLanguageIndex(language);
+	if (!languageIndex)
 	{
 		return std::nullopt;
 	}
 
-	return LanguageToLocalisationMapping->second;
+	return getText(row->second, *languageIndex);
 }
 
 
 Vic2::LanguageToLocalisationMap Vic2::Localisations::getTextInEachLanguage(const std::string& key) const
 {
-	const auto KeyToLocalisationsMappings = localisations.find(key);
-	if (KeyToLocalisationsMappings == localisations.end())
+	const auto row = keyToRowMap.find(key);
+	if (row == keyToRowMap.end())
 	{
 		return LanguageToLocalisationMap{};
 	}
 
-	return KeyToLocalisationsMappings->second;
+	return getRowInEachLanguage(row->second);
 }
 
 
 void Vic2::Localisations::updateDomainCountry(const std::string& tag, const std::string& domainName)
 {
-	if (!localisations.contains(tag))
+	const auto row = keyToRowMap.find(tag);
+	if (row == keyToRowMap.end())
 	{
 		return;
 	}
 
-	auto& nameInAllLanguages = localisations.at(tag);
 	const auto& regionLocalisations = lookupRegionLocalisations(domainName);
 
-	for (auto& [language, nameToUpdate]: nameInAllLanguages)
+	// every language gets its own copy here, as languages showing English text still need their own region names
+	for (const auto& [language, nameToUpdate]: getRowInEachLanguage(row->second))
 	{
 		auto replacementName = determineReplacementName(domainName, regionLocalisations, language);
-		nameToUpdate = std::regex_replace(nameToUpdate, std::regex(R"(\$REGION\$)"), replacementName);
+		textColumns[*getLanguageIndex(language)][row->second] =
+			 std::regex_replace(nameToUpdate, std::regex(R"(\$REGION\$)"), replacementName);
 	}
 }
 
 
+size_t Vic2::Localisations::getOrAddRow(const std::string& key)
+{
+	const auto [row, inserted] = keyToRowMap.insert(std::make_pair(key, keyToRowMap.size()));
+	if (inserted)
+	{
+		for (auto& column: textColumns)
+		{
+			column.emplace_back(std::nullopt);
+		}
+	}
+
+	return row->second;
+}
+
+
+std::optional<std::string> Vic2::Localisations::getText(const size_t row, const size_t language) const
+{
+	const auto& text = textColumns[language][row];
+	if (text && text->empty())
+	{
+		return textColumns[0][row].value_or("");
+	}
+
+	return text;
+}
+
+
+Vic2::LanguageToLocalisationMap Vic2::Localisations::getRowInEachLanguage(const size_t row) const
+{
+	LanguageToLocalisationMap textInEachLanguage;
+	for (size_t language = 0; language < localisationLanguages.size(); language++)
+	{
+		if (const auto text = getText(row, language); text)
+		{
+			textInEachLanguage.insert(std::make_pair(std::string(localisationLanguages[language]), *text));
+		}
+	}
+
+	return textInEachLanguage;
+}
+
+
 Vic2::LanguageToLocalisationMap Vic2::Localisations::lookupRegionLocalisations(const std::string& domainName)
 {
 	LanguageToLocalisationMap regionLocalisations;
-	if (const auto domainKey = localisationToKeyMap.find(domainName); domainKey != localisationToKeyMap.end())
+	if (const auto domainRow = englishTextToRowMap.find(domainName); domainRow != englishTextToRowMap.end())
 	{
-		auto regionsInLanguages = getTextInEachLanguage(domainKey->second);
+		auto regionsInLanguages = getRowInEachLanguage(domainRow->second);
 		for (const auto& regionInLanguage: regionsInLanguages)
 		{
 			regionLocalisations.insert(regionInLanguage);
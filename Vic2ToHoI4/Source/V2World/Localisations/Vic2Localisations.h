@@ -3,10 +3,13 @@
 
 
 
+#include <array>
 #include <map>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 
 
@@ -17,15 +20,30 @@ using LanguageToLocalisationMap = std::map<std::string, std::string>;
 using KeyToLocalisationsMap = std::unordered_map<std::string, LanguageToLocalisationMap>;
 
 
+// the languages of Vic2 localisation files, in the order of their columns
+constexpr std::array<std::string_view, 13> localisationLanguages{"english",
+	 "french",
+	 "german",
+	 "polish",
+	 "spanish",
+	 "italian",
+	 "swedish",
+	 "czech",
+	 "hungarian",
+	 "dutch",
+	 "braz_por",
+	 "russian",
+	 "finnish"};
+
+
 class Localisations
 {
   public:
 	class Factory;
 
-	Localisations(KeyToLocalisationsMap _localisations, std::map<std::string, std::string> _localisationToKeyMap):
-		 localisations(std::move(_localisations)), localisationToKeyMap(std::move(_localisationToKeyMap))
-	{
-	}
+	Localisations() = default;
+	Localisations(const KeyToLocalisationsMap& _localisations,
+		 const std::map<std::string, std::string>& _localisationToKeyMap);
 
 	[[nodiscard]] std::optional<std::string> getTextInLanguage(const std::string& key,
 		 const std::string& language) const;
@@ -34,13 +52,20 @@ class Localisations
 	void updateDomainCountry(const std::string& tag, const std::string& domainName);
 
   private:
+	size_t getOrAddRow(const std::string& key);
+	[[nodiscard]] std::optional<std::string> getText(size_t row, size_t language) const;
+	[[nodiscard]] LanguageToLocalisationMap getRowInEachLanguage(size_t row) const;
+
 	LanguageToLocalisationMap lookupRegionLocalisations(const std::string& domainName);
 	static std::string determineReplacementName(const std::string& domainName,
 		 const LanguageToLocalisationMap& regionLocalisations,
 		 const std::string& language);
 
-	KeyToLocalisationsMap localisations;
-	std::map<std::string, std::string> localisationToKeyMap;
+	// Each key is stored once and gets a row, with a column of text for each language. A language with no text of its
+	// own holds an empty string and shows the English text, so fallbacks are not copied.
+	std::unordered_map<std::string, size_t> keyToRowMap;
+	std::array<std::vector<std::optional<std::string>>, localisationLanguages.size()> textColumns;
+	std::unordered_map<std::string, size_t> englishTextToRowMap;
 };
 
 } // namespace Vic2
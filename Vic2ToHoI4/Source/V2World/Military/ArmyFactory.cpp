@@ -2,6 +2,7 @@
 #include "CommonRegexes.h"
 #include "OSCompatibilityLayer.h"
 #include "ParserHelpers.h"
+#include "V2World/ParseWarning.h"
 
 
 
@@ -35,7 +36,7 @@ std::unique_ptr<Vic2::Army> Vic2::Army::Factory::getArmy(std::string owner, std:
 	parseStream(theStream);
 	if (army->location == std::nullopt)
 	{
-		Log(LogLevel::Warning) << "Army or Navy " << army->name << " has no location";
+		ParseWarning() << "Army or Navy " << army->name << " has no location";
 	}
 	return std::move(army);
 }
\ No newline at end of file
@@ -5,7 +5,12 @@
 
 
 
-Vic2::Leader::Factory::Factory(Traits&& traits_): traits(traits_)
+Vic2::Leader::Factory::Factory(Traits&& traits_): Factory(std::make_shared<const Traits>(std::move(traits_)))
+{
+}
+
+
+Vic2::Leader::Factory::Factory(std::shared_ptr<const Traits> traits_): traits(std::move(traits_))
 {
 	registerKeyword("name", [this](std::istream& theStream) {
 		leader->name = commonItems::singleString{theStream}.getString();
@@ -17,7 +22,7 @@ Vic2::Leader::Factory::Factory(Traits&& traits_): traits(traits_)
 		leader->prestige = commonItems::singleDouble{theStream}.getDouble();
 	});
 	registerRegex("personality|background", [this](const std::string& unused, std::istream& theStream) {
-		for (const auto& effect: traits.getEffectsForTrait(commonItems::singleString{theStream}.getString()))
+		for (const auto& effect: traits->getEffectsForTrait(commonItems::singleString{theStream}.getString()))
 		{
 			auto [effectIterator, inserted] = leader->traitEffects.insert(effect);
 			if (!inserted)
@@ -17,11 +17,12 @@ class Leader::Factory: commonItems::parser
 {
   public:
 	explicit Factory(Traits&& traits_);
+	explicit Factory(std::shared_ptr<const Traits> traits_);
 
 	std::unique_ptr<Leader> getLeader(std::istream& theStream);
 
   private:
-	Traits traits;
+	std::shared_ptr<const Traits> traits;
 	std::unique_ptr<Leader> leader;
 };
 
@@ -2,6 +2,7 @@
 #include "CommonRegexes.h"
 #include "OSCompatibilityLayer.h"
 #include "ParserHelpers.h"
+#include "V2World/ParseWarning.h"
 
 
 
@@ -32,7 +33,7 @@ std::unique_ptr<Vic2::Unit> Vic2::Unit::Factory::getUnit(std::istream& theStream
 	parseStream(theStream);
 	if (unit->type.empty())
 	{
-		Log(LogLevel::Warning) << "Regiment or Ship " << unit->name << " has no type";
+		ParseWarning() << "Regiment or Ship " << unit->name << " has no type";
 	}
 	return std::move(unit);
 }
\ No newline at end of file
@@ -0,0 +1,71 @@
+#ifndef PARSE_WARNING_H
+#define PARSE_WARNING_H
+
+
+
+#include "Log.h"
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+
+namespace Vic2
+{
+
+// While one of these is alive, warnings raised on its thread are kept in the given list instead of being logged. The
+// log can't be written from several threads at once, so save blocks parsed in parallel collect their warnings here
+// and the main thread logs them afterwards, in save order.
+class ParseWarningCollector
+{
+  public:
+	explicit ParseWarningCollector(std::vector<std::string>& warnings): previousWarnings(collectedWarnings)
+	{
+		collectedWarnings = &warnings;
+	}
+	~ParseWarningCollector() { collectedWarnings = previousWarnings; }
+	ParseWarningCollector(const ParseWarningCollector&) = delete;
+	ParseWarningCollector& operator=(const ParseWarningCollector&) = delete;
+
+  private:
+	friend class ParseWarning;
+	inline static thread_local std::vector<std::string>* collectedWarnings = nullptr;
+
+	std::vector<std::string>* previousWarnings;
+};
+
+
+// Used like Log(LogLevel::Warning), but hands the warning to this thread's collector if there is one.
+class ParseWarning
+{
+  public:
+	ParseWarning() = default;
+	~ParseWarning()
+	{
+		if (ParseWarningCollector::collectedWarnings != nullptr)
+		{
+			ParseWarningCollector::collectedWarnings->push_back(message.str());
+		}
+		else
+		{
+			Log(LogLevel::Warning) << message.str();
+		}
+	}
+	ParseWarning(const ParseWarning&) = delete;
+	ParseWarning& operator=(const ParseWarning&) = delete;
+
+	template <typename T> ParseWarning& operator<<(const T& item)
+	{
+		message << item;
+		return *this;
+	}
+
+  private:
+	std::ostringstream message;
+};
+
+} // namespace Vic2
+
+
+
+#endif // PARSE_WARNING_H
\ No newline at end of file
@@ -1,13 +1,15 @@
 #include "Pop.h"
+#include <algorithm>
 
 
 
-float Vic2::Pop::getIssueSupport(const std::string& issueName) const
+float Vic2::Pop::getIssueSupport(const unsigned int issueNumber) const
 {
-	if (!popIssues.contains(issueName))
+	const auto issue = std::ranges::lower_bound(popIssues, issueNumber, {}, &std::pair<unsigned int, float>::first);
+	if (issue == popIssues.end() || issue->first != issueNumber)
 	{
 		return 0.0F;
 	}
 
-	return popIssues.at(issueName);
+	return issue->second;
 }
\ No newline at end of file
@@ -3,8 +3,10 @@
 
 
 
-#include <map>
+#include "PopType.h"
 #include <string>
+#include <utility>
+#include <vector>
 
 
 
@@ -12,6 +14,7 @@ namespace Vic2
 {
 
 
+// A single pop, as read from a save or built in tests. Provinces keep their pops in a PopStore instead.
 class Pop
 {
   public:
@@ -20,21 +23,26 @@ class Pop
 	Pop() = default;
 
 	[[nodiscard]] const auto& getType() const { return type; }
+	[[nodiscard]] auto getPopType() const { return popType; }
 	[[nodiscard]] const auto& getCulture() const { return culture; }
 	[[nodiscard]] const auto& getSize() const { return size; }
 	[[nodiscard]] const auto& getLiteracy() const { return literacy; }
 	[[nodiscard]] const auto& getMilitancy() const { return militancy; }
 
-	[[nodiscard]] float getIssueSupport(const std::string& issueName) const;
+	[[nodiscard]] const auto& getIssues() const { return popIssues; }
+	[[nodiscard]] float getIssueSupport(unsigned int issueNumber) const;
 
   private:
 	std::string type;
+	PopType popType = PopType::other;
 	std::string culture = "no_culture";
 	int size = 0;
 	double literacy = 0.0;
 	double militancy = 0.0;
 
-	std::map<std::string, float> popIssues;
+	// Support for each issue the pop has an opinion on, by issue number (see Issues) and sorted by it. Every pop has
+	// one of these, so it's kept to a flat list of numbers rather than anything keyed by the issues' names.
+	std::vector<std::pair<unsigned int, float>> popIssues;
 };
 
 } // namespace Vic2
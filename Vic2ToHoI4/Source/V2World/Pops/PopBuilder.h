@@ -4,6 +4,7 @@
 
 
 #include "Pop.h"
+#include <algorithm>
 #include <memory>
 
 
@@ -19,6 +20,7 @@ class Pop::Builder
 
 	Builder& setType(std::string type)
 	{
+		pop->popType = Vic2::getPopType(type);
 		pop->type = std::move(type);
 		return *this;
 	}
@@ -47,9 +49,10 @@ class Pop::Builder
 		return *this;
 	}
 
-	Builder& setIssues(std::map<std::string, float> popIssues)
+	Builder& setIssues(std::vector<std::pair<unsigned int, float>> popIssues)
 	{
 		pop->popIssues = std::move(popIssues);
+		std::ranges::sort(pop->popIssues);
 		return *this;
 	}
 
@@ -1,7 +1,8 @@
 #include "PopFactory.h"
 #include "CommonRegexes.h"
-#include "Log.h"
 #include "ParserHelpers.h"
+#include "V2World/ParseWarning.h"
+#include <algorithm>
 
 
 
@@ -21,12 +22,16 @@ Vic2::Pop::Factory::Factory(Issues _theIssues): theIssues(std::move(_theIssues))
 		{
 			try
 			{
-				auto issueName = theIssues.getIssueName(std::stoi(issue));
-				pop->popIssues.insert(std::make_pair(issueName, std::stof(value)));
+				const auto issueNumber = static_cast<unsigned int>(std::stoi(issue));
+				const auto support = std::stof(value);
+				if (theIssues.isValidIssueNumber(issueNumber))
+				{
+					pop->popIssues.emplace_back(issueNumber, support);
+				}
 			}
 			catch (...)
 			{
-				Log(LogLevel::Warning) << "Poorly formatted pop issue: " << issue << "=" << value;
+				ParseWarning() << "Poorly formatted pop issue: " << issue << "=" << value;
 			}
 		}
 	});
@@ -49,8 +54,12 @@ std::unique_ptr<Vic2::Pop> Vic2::Pop::Factory::getPop(const std::string& typeStr
 {
 	pop = std::make_unique<Pop>();
 	pop->type = typeString;
+	pop->popType = Vic2::getPopType(typeString);
 
 	parseStream(theStream);
 
+	// issues come out of the parser ordered by their text, so 10 comes before 2
+	std::ranges::sort(pop->popIssues);
+
 	return std::move(pop);
 }
\ No newline at end of file
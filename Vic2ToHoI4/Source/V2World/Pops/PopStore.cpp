@@ -0,0 +1,219 @@
+#include "PopStore.h"
+#include "PopBuilder.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+
+
+Vic2::PopStore::Rows Vic2::PopStore::addPops(const std::vector<Pop>& pops)
+{
+	const Rows rows{sizes.size(), sizes.size() + pops.size()};
+	for (const auto& pop: pops)
+	{
+		typeIds.push_back(addTypeName(pop.getType()));
+		cultureIds.push_back(addCultureName(pop.getCulture()));
+		sizes.push_back(pop.getSize());
+		literacies.push_back(pop.getLiteracy());
+		militancies.push_back(pop.getMilitancy());
+		addIssues(pop.getIssues());
+	}
+
+	return rows;
+}
+
+
+Vic2::PopStore::Rows Vic2::PopStore::addRows(const PopStore& other, const Rows& rows)
+{
+	// the other store numbers its types and cultures its own way
+	std::vector<std::uint16_t> otherTypeIds;
+	for (const auto& typeName: other.typeNames)
+	{
+		otherTypeIds.push_back(addTypeName(typeName));
+	}
+	std::vector<unsigned int> otherCultureIds;
+	for (const auto& culture: other.cultureNames)
+	{
+		otherCultureIds.push_back(addCultureName(culture));
+	}
+
+	const Rows addedRows{sizes.size(), sizes.size() + (rows.last - rows.first)};
+	for (auto row = rows.first; row < rows.last; row++)
+	{
+		typeIds.push_back(otherTypeIds[other.typeIds[row]]);
+		cultureIds.push_back(otherCultureIds[other.cultureIds[row]]);
+		sizes.push_back(other.sizes[row]);
+		literacies.push_back(other.literacies[row]);
+		militancies.push_back(other.militancies[row]);
+
+		issueNumbers.insert(issueNumbers.end(),
+			 other.issueNumbers.begin() + other.issueOffsets[row],
+			 other.issueNumbers.begin() + other.issueOffsets[row + 1]);
+		issueSupports.insert(issueSupports.end(),
+			 other.issueSupports.begin() + other.issueOffsets[row],
+			 other.issueSupports.begin() + other.issueOffsets[row + 1]);
+		issueOffsets.push_back(static_cast<std::uint32_t>(issueNumbers.size()));
+	}
+
+	return addedRows;
+}
+
+
+void Vic2::PopStore::indexCultures(CultureGroups& cultureGroups)
+{
+	// only cultures added since the last indexing need an ID
+	for (auto cultureId = cultureGroupsIds.size(); cultureId < cultureNames.size(); cultureId++)
+	{
+		cultureGroupsIds.push_back(cultureGroups.addCulture(cultureNames[cultureId]));
+	}
+}
+
+
+std::vector<Vic2::Pop> Vic2::PopStore::getPops(const Rows& rows) const
+{
+	std::vector<Pop> pops;
+	for (auto row = rows.first; row < rows.last; row++)
+	{
+		std::vector<std::pair<unsigned int, float>> popIssues;
+		for (auto issue = issueOffsets[row]; issue < issueOffsets[row + 1]; issue++)
+		{
+			popIssues.emplace_back(issueNumbers[issue], issueSupports[issue]);
+		}
+
+		pops.push_back(*Pop::Builder()
+								.setType(typeNames[typeIds[row]])
+								.setCulture(cultureNames[cultureIds[row]])
+								.setSize(sizes[row])
+								.setLiteracy(literacies[row])
+								.setMilitancy(militancies[row])
+								.setIssues(std::move(popIssues))
+								.build());
+	}
+
+	return pops;
+}
+
+
+std::map<std::string, int> Vic2::PopStore::getPopulationByCulture(const Rows& rows) const
+{
+	std::map<std::string, int> populationByCulture;
+	for (const auto& [cultureId, population]: getPopulationByCultureId(rows))
+	{
+		populationByCulture.emplace(cultureNames[cultureId], population);
+	}
+
+	return populationByCulture;
+}
+
+
+int Vic2::PopStore::getPopulationWithCultures(const Rows& rows, const std::set<std::string>& cultures) const
+{
+	auto population = 0;
+	for (const auto& [cultureId, culturePopulation]: getPopulationByCultureId(rows))
+	{
+		if (cultures.contains(cultureNames[cultureId]))
+		{
+			population += culturePopulation;
+		}
+	}
+
+	return population;
+}
+
+
+int Vic2::PopStore::getPopulationWithCultures(const Rows& rows, const CultureSet& cultures) const
+{
+	auto population = 0;
+	for (auto row = rows.first; row < rows.last; row++)
+	{
+		if (const auto cultureId = cultureIds[row];
+			 cultureId < cultureGroupsIds.size() && cultures.contains(cultureGroupsIds[cultureId]))
+		{
+			population += sizes[row];
+		}
+	}
+
+	return population;
+}
+
+
+float Vic2::PopStore::getPopulationWeightedIssueSupport(const Rows& rows, const unsigned int issueNumber) const
+{
+	auto support = 0.0F;
+	for (auto row = rows.first; row < rows.last; row++)
+	{
+		const auto popIssuesEnd = issueNumbers.begin() + issueOffsets[row + 1];
+		if (const auto issue = std::lower_bound(issueNumbers.begin() + issueOffsets[row], popIssuesEnd, issueNumber);
+			 issue != popIssuesEnd && *issue == issueNumber)
+		{
+			support += issueSupports[issue - issueNumbers.begin()] * static_cast<float>(sizes[row]);
+		}
+	}
+
+	return support;
+}
+
+
+std::uint16_t Vic2::PopStore::addTypeName(const std::string& typeName)
+{
+	if (const auto existing = std::ranges::find(typeNames, typeName); existing != typeNames.end())
+	{
+		return static_cast<std::uint16_t>(existing - typeNames.begin());
+	}
+
+	if (typeNames.size() > std::numeric_limits<std::uint16_t>::max())
+	{
+		throw std::runtime_error("Too many pop types to store.");
+	}
+	typeNames.push_back(typeName);
+	popTypes.push_back(Vic2::getPopType(typeName));
+	return static_cast<std::uint16_t>(typeNames.size() - 1);
+}
+
+
+unsigned int Vic2::PopStore::addCultureName(const std::string& culture)
+{
+	const auto [cultureId, inserted] =
+		 cultureIdsByName.emplace(culture, static_cast<unsigned int>(cultureNames.size()));
+	if (inserted)
+	{
+		cultureNames.push_back(culture);
+	}
+
+	return cultureId->second;
+}
+
+
+void Vic2::PopStore::addIssues(const std::vector<std::pair<unsigned int, float>>& popIssues)
+{
+	for (const auto& [issueNumber, support]: popIssues)
+	{
+		issueNumbers.push_back(issueNumber);
+		issueSupports.push_back(support);
+	}
+	issueOffsets.push_back(static_cast<std::uint32_t>(issueNumbers.size()));
+}
+
+
+std::vector<std::pair<unsigned int, int>> Vic2::PopStore::getPopulationByCultureId(const Rows& rows) const
+{
+	// a province only has a few cultures, so a short list beats anything keyed
+	std::vector<std::pair<unsigned int, int>> populationByCultureId;
+	for (auto row = rows.first; row < rows.last; row++)
+	{
+		const auto cultureId = cultureIds[row];
+		if (const auto existing = std::ranges::find(populationByCultureId,
+				  cultureId,
+				  &std::pair<unsigned int, int>::first);
+			 existing != populationByCultureId.end())
+		{
+			existing->second += sizes[row];
+		}
+		else
+		{
+			populationByCultureId.emplace_back(cultureId, sizes[row]);
+		}
+	}
+
+	return populationByCultureId;
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#ifndef VIC2_POP_STORE_H_
+#define VIC2_POP_STORE_H_
+
+
+
+#include "Pop.h"
+#include "PopType.h"
+#include "V2World/Culture/CultureGroups.h"
+#include "V2World/Culture/CultureSet.h"
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+
+
+namespace Vic2
+{
+
+// Pops kept as one column per field, so population rollups only read the fields they need. Pop types and cultures are
+// stored as indexes into lists of their names, and every pop's issues are a slice of two shared columns. A world keeps
+// all its pops in one store, with each province owning a range of rows.
+class PopStore
+{
+  public:
+	struct Rows
+	{
+		size_t first = 0;
+		size_t last = 0;
+	};
+
+	Rows addPops(const std::vector<Pop>& pops);
+	Rows addRows(const PopStore& other, const Rows& rows);
+	void indexCultures(CultureGroups& cultureGroups);
+
+	[[nodiscard]] PopType getPopType(const size_t row) const { return popTypes[typeIds[row]]; }
+	[[nodiscard]] int getSize(const size_t row) const { return sizes[row]; }
+	[[nodiscard]] double getLiteracy(const size_t row) const { return literacies[row]; }
+
+	[[nodiscard]] std::vector<Pop> getPops(const Rows& rows) const;
+	[[nodiscard]] std::map<std::string, int> getPopulationByCulture(const Rows& rows) const;
+	[[nodiscard]] int getPopulationWithCultures(const Rows& rows, const std::set<std::string>& cultures) const;
+	[[nodiscard]] int getPopulationWithCultures(const Rows& rows, const CultureSet& cultures) const; // needs indexing
+	[[nodiscard]] float getPopulationWeightedIssueSupport(const Rows& rows, unsigned int issueNumber) const;
+
+  private:
+	[[nodiscard]] std::uint16_t addTypeName(const std::string& typeName);
+	[[nodiscard]] unsigned int addCultureName(const std::string& culture);
+	void addIssues(const std::vector<std::pair<unsigned int, float>>& popIssues);
+	[[nodiscard]] std::vector<std::pair<unsigned int, int>> getPopulationByCultureId(const Rows& rows) const;
+
+	std::vector<std::uint16_t> typeIds;
+	std::vector<unsigned int> cultureIds;
+	std::vector<int> sizes;
+	std::vector<double> literacies;
+	std::vector<double> militancies;
+
+	// a pop's issues run from its offset to the next pop's, sorted by issue number
+	std::vector<std::uint32_t> issueOffsets{0};
+	std::vector<unsigned int> issueNumbers;
+	std::vector<float> issueSupports;
+
+	std::vector<std::string> typeNames;
+	std::vector<PopType> popTypes; // for each type name
+	std::vector<std::string> cultureNames;
+	std::unordered_map<std::string, unsigned int> cultureIdsByName;
+	std::vector<unsigned int> cultureGroupsIds; // the CultureGroups ID of each culture indexed so far
+};
+
+} // namespace Vic2
+
+
+
+#endif // VIC2_POP_STORE_H_
\ No newline at end of file
@@ -0,0 +1,40 @@
+#include "PopType.h"
+#include <algorithm>
+#include <array>
+#include <utility>
+
+
+
+namespace
+{
+
+constexpr std::array<std::pair<std::string_view, Vic2::PopType>, Vic2::numPopTypes - 1> popTypeNames{{
+	 {"aristocrats", Vic2::PopType::aristocrats},
+	 {"artisans", Vic2::PopType::artisans},
+	 {"bureaucrats", Vic2::PopType::bureaucrats},
+	 {"capitalists", Vic2::PopType::capitalists},
+	 {"clergymen", Vic2::PopType::clergymen},
+	 {"clerks", Vic2::PopType::clerks},
+	 {"craftsmen", Vic2::PopType::craftsmen},
+	 {"farmers", Vic2::PopType::farmers},
+	 {"labourers", Vic2::PopType::labourers},
+	 {"officers", Vic2::PopType::officers},
+	 {"serfs", Vic2::PopType::serfs},
+	 {"slaves", Vic2::PopType::slaves},
+	 {"soldiers", Vic2::PopType::soldiers},
+}};
+
+} // namespace
+
+
+
+Vic2::PopType Vic2::getPopType(const std::string_view typeString)
+{
+	const auto popTypeName = std::ranges::find(popTypeNames, typeString, &std::pair<std::string_view, PopType>::first);
+	if (popTypeName == popTypeNames.end())
+	{
+		return PopType::other;
+	}
+
+	return popTypeName->second;
+}
\ No newline at end of file
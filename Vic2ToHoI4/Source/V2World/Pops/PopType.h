@@ -0,0 +1,42 @@
+#ifndef VIC2_POP_TYPE_H
+#define VIC2_POP_TYPE_H
+
+
+
+#include <cstddef>
+#include <string_view>
+
+
+
+namespace Vic2
+{
+
+// The types of pop a Vic2 province can have. Anything else is 'other'.
+enum class PopType
+{
+	aristocrats,
+	artisans,
+	bureaucrats,
+	capitalists,
+	clergymen,
+	clerks,
+	craftsmen,
+	farmers,
+	labourers,
+	officers,
+	serfs,
+	slaves,
+	soldiers,
+	other
+};
+
+constexpr size_t numPopTypes = static_cast<size_t>(PopType::other) + 1;
+
+
+[[nodiscard]] PopType getPopType(std::string_view typeString);
+
+} // namespace Vic2
+
+
+
+#endif // VIC2_POP_TYPE_H
\ No newline at end of file
@@ -8,60 +8,148 @@ int Vic2::Province::getTotalPopulation() const
 }
 
 
-int Vic2::Province::getPopulation(const std::optional<std::string>& type) const
+int Vic2::Province::getPopulation(const std::optional<PopType>& type) const
 {
-	auto totalPopulation = 0;
-	for (const auto& pop: pops)
+	if (!type)
 	{
-		if (!type || *type == pop.getType())
-		{
-			totalPopulation += pop.getSize();
-		}
+		return totalPopulation;
 	}
 
-	return totalPopulation;
+	return populationByType[static_cast<size_t>(*type)];
 }
 
 
-int Vic2::Province::getLiteracyWeightedPopulation(const std::optional<std::string>& type) const
+int Vic2::Province::getLiteracyWeightedPopulation(const std::optional<PopType>& type) const
 {
-	auto totalPopulation = 0;
-	for (const auto& pop: pops)
+	if (!type)
 	{
-		if (!type || *type == pop.getType())
-		{
-			totalPopulation += calculateLiteracyWeightedPop(pop);
-		}
+		return totalLiteracyWeightedPopulation;
 	}
-	return totalPopulation;
+
+	return literacyWeightedPopulationByType[static_cast<size_t>(*type)];
 }
 
 
 double Vic2::Province::getPercentageWithCultures(const std::set<std::string>& cultures) const
 {
-	auto totalPopulation = 0;
-	auto populationOfCultures = 0;
-
-	for (const auto& pop: pops)
+	if (totalPopulation <= 0)
 	{
-		totalPopulation += pop.getSize();
-		if (cultures.contains(pop.getCulture()))
-		{
-			populationOfCultures += pop.getSize();
-		}
+		return 0.0;
 	}
+	return 1.0 * popStore->getPopulationWithCultures(popRows, cultures) / totalPopulation;
+}
+
 
+double Vic2::Province::getPercentageWithCultures(const CultureSet& cultures) const
+{
 	if (totalPopulation <= 0)
 	{
 		return 0.0;
 	}
-	return 1.0 * populationOfCultures / totalPopulation;
+	return 1.0 * popStore->getPopulationWithCultures(popRows, cultures) / totalPopulation;
+}
+
+
+std::map<std::string, int> Vic2::Province::getPopulationByCulture() const
+{
+	if (!popStore)
+	{
+		return {};
+	}
+	return popStore->getPopulationByCulture(popRows);
+}
+
+
+float Vic2::Province::getPopulationWeightedIssueSupport(const unsigned int issueNumber) const
+{
+	if (!popStore)
+	{
+		return 0.0F;
+	}
+	return popStore->getPopulationWeightedIssueSupport(popRows, issueNumber);
+}
+
+
+void Vic2::Province::indexCultures(CultureGroups& cultureGroups)
+{
+	if (popStore)
+	{
+		popStore->indexCultures(cultureGroups);
+	}
+}
+
+
+void Vic2::Province::movePopsTo(const std::shared_ptr<PopStore>& worldPopStore)
+{
+	if (!popStore || popStore == worldPopStore)
+	{
+		return;
+	}
+
+	popRows = worldPopStore->addRows(*popStore, popRows);
+	popStore = worldPopStore;
+}
+
+
+void Vic2::Province::addCore(const std::string_view core)
+{
+	if (const auto tag = Tag::parse(core); tag)
+	{
+		cores.insert(*tag);
+	}
+}
+
+
+void Vic2::Province::removeCore(const std::string_view core)
+{
+	if (const auto tag = Tag::parse(core); tag)
+	{
+		cores.erase(*tag);
+	}
+}
+
+
+std::vector<Vic2::Pop> Vic2::Province::getPops() const
+{
+	if (!popStore)
+	{
+		return {};
+	}
+	return popStore->getPops(popRows);
 }
 
 
 constexpr double minimumLiteracyWeighting = 0.1;
 constexpr double literacyWeighting = 0.9;
-int Vic2::Province::calculateLiteracyWeightedPop(const Pop& thePop)
+int Vic2::Province::calculateLiteracyWeightedPop(const int size, const double literacy)
 {
-	return static_cast<int>(thePop.getSize() * (thePop.getLiteracy() * literacyWeighting + minimumLiteracyWeighting));
+	return static_cast<int>(size * (literacy * literacyWeighting + minimumLiteracyWeighting));
 }
+
+
+void Vic2::Province::setPops(const std::vector<Pop>& pops)
+{
+	popStore = std::make_shared<PopStore>();
+	popRows = popStore->addPops(pops);
+	tallyPops();
+}
+
+
+void Vic2::Province::tallyPops()
+{
+	populationByType.fill(0);
+	literacyWeightedPopulationByType.fill(0);
+	totalPopulation = 0;
+	totalLiteracyWeightedPopulation = 0;
+
+	for (auto row = popRows.first; row < popRows.last; row++)
+	{
+		const auto size = popStore->getSize(row);
+		const auto popType = static_cast<size_t>(popStore->getPopType(row));
+		const auto literacyWeightedPop = calculateLiteracyWeightedPop(size, popStore->getLiteracy(row));
+		populationByType[popType] += size;
+		literacyWeightedPopulationByType[popType] += literacyWeightedPop;
+		totalPopulation += size;
+		totalLiteracyWeightedPopulation += literacyWeightedPop;
+	}
+}
\ No newline at end of file
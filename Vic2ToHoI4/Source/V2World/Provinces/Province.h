@@ -3,11 +3,21 @@
 
 
 
+#include "V2World/Culture/CultureGroups.h"
+#include "V2World/Culture/CultureSet.h"
 #include "V2World/Pops/Pop.h"
 #include "V2World/Pops/PopFactory.h"
+#include "V2World/Pops/PopStore.h"
+#include "TagSet.h"
+#include "V2World/Pops/PopType.h"
+#include <array>
+#include <map>
+#include <memory>
 #include <optional>
 #include <set>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 
@@ -23,32 +33,47 @@ class Province
 	Province() = default;
 
 	[[nodiscard]] int getTotalPopulation() const;
-	[[nodiscard]] int getPopulation(const std::optional<std::string>& type = {}) const;
-	[[nodiscard]] int getLiteracyWeightedPopulation(const std::optional<std::string>& type = {}) const;
+	[[nodiscard]] int getPopulation(const std::optional<PopType>& type = {}) const;
+	[[nodiscard]] int getLiteracyWeightedPopulation(const std::optional<PopType>& type = {}) const;
 	[[nodiscard]] double getPercentageWithCultures(const std::set<std::string>& cultures) const;
+	[[nodiscard]] double getPercentageWithCultures(const CultureSet& cultures) const; // needs cultures to be indexed
+	[[nodiscard]] std::map<std::string, int> getPopulationByCulture() const;
+	[[nodiscard]] float getPopulationWeightedIssueSupport(unsigned int issueNumber) const;
 
+	void indexCultures(CultureGroups& cultureGroups);
+	void movePopsTo(const std::shared_ptr<PopStore>& worldPopStore);
 	void setOwner(const std::string& _owner) { owner = _owner; }
-	void addCore(const std::string& core) { cores.insert(core); }
-	void removeCore(const std::string& core) { cores.erase(core); }
+	void addCore(std::string_view core);
+	void removeCore(std::string_view core);
 
 	[[nodiscard]] const auto& getNumber() const { return number; }
 	[[nodiscard]] const auto& getOwner() const { return owner; }
 	[[nodiscard]] const auto& getController() const { return controller; }
 	[[nodiscard]] const auto& getCores() const { return cores; }
-	[[nodiscard]] const auto& getPops() const { return pops; }
+	[[nodiscard]] std::vector<Pop> getPops() const;
 	[[nodiscard]] const auto& getNavalBaseLevel() const { return navalBaseLevel; }
 	[[nodiscard]] const auto& getRailLevel() const { return railLevel; }
 
   private:
-	[[nodiscard]] static int calculateLiteracyWeightedPop(const Pop& thePop);
+	[[nodiscard]] static int calculateLiteracyWeightedPop(int size, double literacy);
+	void setPops(const std::vector<Pop>& pops);
+	void tallyPops();
 
 	int number = 0;
 
 	std::string owner;
 	std::string controller;
-	std::set<std::string> cores;
+	TagSet cores;
 
-	std::vector<Pop> pops;
+	// this province's pops are a range of rows in a store, shared with every other province once the world is imported
+	std::shared_ptr<PopStore> popStore;
+	PopStore::Rows popRows;
+
+	// totals over the pops by type, tallied once they're all known as they're asked for most often
+	std::array<int, numPopTypes> populationByType{};
+	std::array<int, numPopTypes> literacyWeightedPopulationByType{};
+	int totalPopulation = 0;
+	int totalLiteracyWeightedPopulation = 0;
 
 	int navalBaseLevel = 0;
 	int railLevel = 0;
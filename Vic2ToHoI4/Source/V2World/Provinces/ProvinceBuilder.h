@@ -46,15 +46,18 @@ class Province::Builder
 		return *this;
 	}
 
-	Builder& setCores(std::set<std::string> cores)
+	Builder& setCores(const std::set<std::string>& cores)
 	{
-		province->cores = std::move(cores);
+		for (const auto& core: cores)
+		{
+			province->addCore(core);
+		}
 		return *this;
 	}
 
-	Builder& setPops(std::vector<Pop> pops)
+	Builder& setPops(const std::vector<Pop>& pops)
 	{
-		province->pops = std::move(pops);
+		province->setPops(pops);
 		return *this;
 	}
 
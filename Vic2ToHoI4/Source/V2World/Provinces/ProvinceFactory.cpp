@@ -1,6 +1,7 @@
 #include "ProvinceFactory.h"
 #include "CommonRegexes.h"
 #include "ParserHelpers.h"
+#include "V2World/ParseWarning.h"
 
 
 
@@ -10,7 +11,15 @@ Vic2::Province::Factory::Factory(std::unique_ptr<Pop::Factory>&& _popFactory): p
 		province->owner = commonItems::singleString{theStream}.getString();
 	});
 	registerKeyword("core", [this](std::istream& theStream) {
-		province->cores.insert(commonItems::singleString{theStream}.getString());
+		const auto core = commonItems::singleString{theStream}.getString();
+		if (const auto tag = Tag::parse(core); tag)
+		{
+			province->cores.insert(*tag);
+		}
+		else
+		{
+			ParseWarning() << "Province " << province->number << " has a core for invalid tag " << core;
+		}
 	});
 	registerKeyword("controller", [this](std::istream& theStream) {
 		province->controller = commonItems::singleString{theStream}.getString();
@@ -25,7 +34,7 @@ Vic2::Province::Factory::Factory(std::unique_ptr<Pop::Factory>&& _popFactory): p
 		 "aristocrats|artisans|bureaucrats|capitalists|clergymen|craftsmen|clerks|farmers|soldiers|officers|labourers|"
 		 "slaves|serfs",
 		 [this](const std::string& popType, std::istream& theStream) {
-			 province->pops.push_back(*popFactory->getPop(popType, theStream));
+			 pops.push_back(*popFactory->getPop(popType, theStream));
 		 });
 	registerRegex(commonItems::catchallRegex, commonItems::ignoreItem);
 }
@@ -35,8 +44,10 @@ std::unique_ptr<Vic2::Province> Vic2::Province::Factory::getProvince(int number,
 {
 	province = std::make_unique<Province>();
 	province->number = number;
+	pops.clear();
 
 	parseStream(theStream);
+	province->setPops(pops);
 
 	return std::move(province);
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "Parser.h"
 #include "Province.h"
 #include <memory>
+#include <vector>
 
 
 
@@ -20,6 +21,7 @@ class Province::Factory: commonItems::parser
 
   private:
 	std::unique_ptr<Province> province;
+	std::vector<Pop> pops;
 	std::unique_ptr<Pop::Factory> popFactory;
 };
 
@@ -19,10 +19,10 @@ Vic2::workerStruct Vic2::State::countEmployedWorkers() const
 
 	for (const auto& province: provinces)
 	{
-		workers.craftsmen += static_cast<float>(province->getPopulation("craftsmen"));
-		workers.clerks += static_cast<float>(province->getPopulation("clerks"));
-		workers.artisans += static_cast<float>(province->getPopulation("artisans"));
-		workers.capitalists += static_cast<float>(province->getLiteracyWeightedPopulation("capitalists"));
+		workers.craftsmen += static_cast<float>(province->getPopulation(PopType::craftsmen));
+		workers.clerks += static_cast<float>(province->getPopulation(PopType::clerks));
+		workers.artisans += static_cast<float>(province->getPopulation(PopType::artisans));
+		workers.capitalists += static_cast<float>(province->getLiteracyWeightedPopulation(PopType::capitalists));
 	}
 
 	return workers;
@@ -59,7 +59,7 @@ void Vic2::State::eatState(const State& state, const StateDefinitions& stateDefi
 	provinces.insert(state.provinces.begin(), state.provinces.end());
 
 	partialState = false;
-	for (const auto provinceNumber: stateDefinitions.getAllProvinces(*provinceNumbers.begin()))
+	for (const auto provinceNumber: stateDefinitions.getStateProvinces(*provinceNumbers.begin()))
 	{
 		if (!provinceNumbers.contains(provinceNumber))
 		{
@@ -105,8 +105,8 @@ std::optional<int> Vic2::State::getUpperClassLocation() const
 {
 	for (const auto& province: provinces)
 	{
-		if ((province->getPopulation("aristocrats") > 0) || (province->getPopulation("bureaucrats") > 0) ||
-			 (province->getPopulation("capitalists") > 0))
+		if ((province->getPopulation(PopType::aristocrats) > 0) || (province->getPopulation(PopType::bureaucrats) > 0) ||
+			 (province->getPopulation(PopType::capitalists) > 0))
 		{
 			return province->getNumber();
 		}
@@ -5,12 +5,21 @@
 
 std::set<int> Vic2::StateDefinitions::getAllProvinces(const int provinceNumber) const
 {
-	if (!stateMap.contains(provinceNumber))
+	const auto provinces = getStateProvinces(provinceNumber);
+	return {provinces.begin(), provinces.end()};
+}
+
+
+std::span<const int> Vic2::StateDefinitions::getStateProvinces(const int provinceNumber) const
+{
+	const auto state = provinceToStateMap.find(provinceNumber);
+	if (state == provinceToStateMap.end())
 	{
 		return {};
 	}
 
-	return stateMap.at(provinceNumber);
+	const auto start = stateOffsets[state->second];
+	return std::span(stateProvinces).subspan(start, stateOffsets[state->second + 1] - start);
 }
 
 
@@ -33,4 +42,12 @@ std::optional<int> Vic2::StateDefinitions::getCapitalProvince(const std::string&
 	}
 
 	return stateToCapitalMap.at(stateID);
+}
+
+
+size_t Vic2::StateDefinitions::addState(const std::set<int>& provinces)
+{
+	stateProvinces.insert(stateProvinces.end(), provinces.begin(), provinces.end());
+	stateOffsets.push_back(stateProvinces.size());
+	return stateOffsets.size() - 2;
 }
\ No newline at end of file
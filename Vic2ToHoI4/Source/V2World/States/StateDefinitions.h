@@ -6,7 +6,9 @@
 #include <map>
 #include <optional>
 #include <set>
+#include <span>
 #include <string>
+#include <vector>
 
 
 
@@ -20,11 +22,17 @@ class StateDefinitions
 	class Factory;
 
 	[[nodiscard]] std::set<int> getAllProvinces(int provinceNumber) const;
+	[[nodiscard]] std::span<const int> getStateProvinces(int provinceNumber) const;
 	[[nodiscard]] std::optional<std::string> getStateID(int provinceNumber) const;
 	[[nodiscard]] std::optional<int> getCapitalProvince(const std::string& stateID) const;
 
   private:
-	std::map<int, std::set<int>> stateMap; // < province, all other provinces in state >
+	size_t addState(const std::set<int>& provinces);
+
+	// every state's provinces are stored once, one state after another, and each province points at its state
+	std::vector<int> stateProvinces;
+	std::vector<size_t> stateOffsets{0}; // where each state starts in stateProvinces, then where the last one ends
+	std::map<int, size_t> provinceToStateMap;
 	std::map<int, std::string> provinceToIDMap;
 	std::map<std::string, int> stateToCapitalMap;
 };
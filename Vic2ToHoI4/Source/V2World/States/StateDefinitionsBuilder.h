@@ -17,9 +17,19 @@ class StateDefinitions::Builder
 	Builder() { stateDefinitions = std::make_unique<StateDefinitions>(); }
 	std::unique_ptr<StateDefinitions> build() { return std::move(stateDefinitions); }
 
-	Builder& setStateMap(std::map<int, std::set<int>> stateMap)
+	Builder& setStateMap(const std::map<int, std::set<int>>& stateMap)
 	{
-		stateDefinitions->stateMap = std::move(stateMap);
+		// provinces listing the same neighbors share one state
+		std::map<std::set<int>, size_t> states;
+		for (const auto& [province, provinces]: stateMap)
+		{
+			auto [state, inserted] = states.insert(std::make_pair(provinces, 0));
+			if (inserted)
+			{
+				state->second = stateDefinitions->addState(provinces);
+			}
+			stateDefinitions->provinceToStateMap.insert(std::make_pair(province, state->second));
+		}
 		return *this;
 	}
 
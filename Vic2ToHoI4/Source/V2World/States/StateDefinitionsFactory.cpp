@@ -18,9 +18,10 @@ Vic2::StateDefinitions::Factory::Factory()
 			stateDefinitions->provinceToIDMap.insert(std::make_pair(provinceNumber, stateID));
 		}
 
+		const auto state = stateDefinitions->addState(neighbors);
 		for (auto neighbor: neighbors)
 		{
-			stateDefinitions->stateMap.insert(make_pair(neighbor, neighbors));
+			stateDefinitions->provinceToStateMap.insert(std::make_pair(neighbor, state));
 		}
 
 		if (!provinceNumbers.empty())
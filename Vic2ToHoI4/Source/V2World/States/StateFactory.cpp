@@ -1,9 +1,9 @@
 #include "StateFactory.h"
 #include "BuildingReader.h"
 #include "CommonRegexes.h"
-#include "Log.h"
 #include "ParserHelpers.h"
 #include "StateDefinitions.h"
+#include "V2World/ParseWarning.h"
 
 
 
@@ -69,7 +69,7 @@ void Vic2::State::Factory::setID(const StateDefinitions& theStateDefinitions) co
 	}
 	else
 	{
-		Log(LogLevel::Warning) << "Could not find the state for Vic2 province " << *provinceNumbers.begin() << ".";
+		ParseWarning() << "Could not find the state for Vic2 province " << *provinceNumbers.begin() << ".";
 	}
 }
 
@@ -88,7 +88,7 @@ void Vic2::State::Factory::determineIfPartialState(const StateDefinitions& theSt
 		return;
 	}
 
-	for (auto expectedProvince: theStateDefinitions.getAllProvinces(*provinceNumbers.begin()))
+	for (auto expectedProvince: theStateDefinitions.getStateProvinces(*provinceNumbers.begin()))
 	{
 		if (!provinceNumbers.contains(expectedProvince))
 		{
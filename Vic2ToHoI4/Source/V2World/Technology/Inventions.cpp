@@ -1,7 +1,7 @@
 #include "Inventions.h"
-#include "Log.h"
 #include "OSCompatibilityLayer.h"
 #include "ParserHelpers.h"
+#include "V2World/ParseWarning.h"
 
 
 
@@ -9,12 +9,12 @@ std::optional<std::string> Vic2::Inventions::getInventionName(unsigned int inven
 {
 	if (inventionNumber == 0)
 	{
-		Log(LogLevel::Warning) << "Invalid invention zero.";
+		ParseWarning() << "Invalid invention zero.";
 		return {};
 	}
 	if (static_cast<size_t>(inventionNumber) > inventionNames.size())
 	{
-		Log(LogLevel::Warning) << "Invalid invention. Is this using a mod that changed inventions?";
+		ParseWarning() << "Invalid invention. Is this using a mod that changed inventions?";
 		return {};
 	}
 
@@ -0,0 +1,328 @@
+#include "SaveReader.h"
+#include "Log.h"
+#include <fstream>
+#include <optional>
+
+
+
+namespace
+{
+
+constexpr std::string_view utf8BOM = "\xEF\xBB\xBF";
+
+
+bool isWhitespace(const char character)
+{
+	return (character == ' ') || (character == '\t') || (character == '\n') || (character == '\r') ||
+			 (character == '\v') || (character == '\f');
+}
+
+
+bool endsToken(const char character)
+{
+	return isWhitespace(character) || (character == '=') || (character == '{') || (character == '}') ||
+			 (character == '#') || (character == '"');
+}
+
+
+bool isUpperOrDigit(const char character)
+{
+	return ((character >= 'A') && (character <= 'Z')) || ((character >= '0') && (character <= '9'));
+}
+
+
+// Works out what an item is from its key alone, looking at no more than a few characters
+std::optional<Vic2::SaveReader::ItemType> classifyKey(const std::string_view key)
+{
+	using ItemType = Vic2::SaveReader::ItemType;
+
+	if ((key.size() == 3) && (key[0] >= 'A') && (key[0] <= 'Z') && isUpperOrDigit(key[1]) && isUpperOrDigit(key[2]))
+	{
+		return ItemType::Country;
+	}
+
+	// nine digits always fit in an int
+	if ((key.size() <= 9) && (key.find_first_not_of("0123456789") == std::string_view::npos))
+	{
+		return ItemType::Province;
+	}
+
+	if (key == "date")
+	{
+		return ItemType::Date;
+	}
+	if (key == "great_nations")
+	{
+		return ItemType::GreatNations;
+	}
+	if (key == "diplomacy")
+	{
+		return ItemType::Diplomacy;
+	}
+	if (key == "active_war")
+	{
+		return ItemType::ActiveWar;
+	}
+	return std::nullopt;
+}
+
+
+class Lexer
+{
+  public:
+	explicit Lexer(const std::string_view text): text(text) {}
+
+	[[nodiscard]] bool atEnd() const { return position >= text.size(); }
+	[[nodiscard]] char peek() const { return text[position]; }
+	[[nodiscard]] size_t getPosition() const { return position; }
+	void advance() { position++; }
+
+	void skipWhitespaceAndComments()
+	{
+		while (!atEnd())
+		{
+			if (isWhitespace(peek()))
+			{
+				position++;
+			}
+			else if (peek() == '#')
+			{
+				skipComment();
+			}
+			else
+			{
+				return;
+			}
+		}
+	}
+
+	std::string_view readBareToken()
+	{
+		const auto start = position;
+		while (!atEnd() && !endsToken(peek()))
+		{
+			position++;
+		}
+		return text.substr(start, position - start);
+	}
+
+	void skipQuotedString()
+	{
+		position++;
+		while (!atEnd() && (peek() != '"'))
+		{
+			position++;
+		}
+		if (!atEnd())
+		{
+			position++;
+		}
+	}
+
+	// skips from an opening brace to just past its matching closing brace, or to the end if there isn't one
+	void skipBlock()
+	{
+		auto depth = 0;
+		while (!atEnd())
+		{
+			if (peek() == '{')
+			{
+				depth++;
+				position++;
+			}
+			else if (peek() == '}')
+			{
+				depth--;
+				position++;
+				if (depth == 0)
+				{
+					return;
+				}
+			}
+			else if (peek() == '"')
+			{
+				skipQuotedString();
+			}
+			else if (peek() == '#')
+			{
+				skipComment();
+			}
+			else
+			{
+				position++;
+			}
+		}
+	}
+
+
+	void skipValue()
+	{
+		if (atEnd())
+		{
+			return;
+		}
+		if (peek() == '{')
+		{
+			skipBlock();
+		}
+		else if (peek() == '"')
+		{
+			skipQuotedString();
+		}
+		else
+		{
+			readBareToken();
+		}
+	}
+
+  private:
+	void skipComment()
+	{
+		while (!atEnd() && (peek() != '\n'))
+		{
+			position++;
+		}
+	}
+
+	std::string_view text;
+	size_t position = 0;
+};
+
+} // namespace
+
+
+
+Vic2::SaveReader::SaveReader(const std::string& filename)
+{
+	std::ifstream saveFile(filename, std::ios::binary | std::ios::ate);
+	if (!saveFile.is_open())
+	{
+		Log(LogLevel::Error) << "Could not open " << filename << " for parsing.";
+		return;
+	}
+
+	contents.resize(static_cast<size_t>(saveFile.tellg()));
+	saveFile.seekg(0);
+	saveFile.read(contents.data(), static_cast<std::streamsize>(contents.size()));
+	contents.resize(static_cast<size_t>(saveFile.gcount()));
+
+	findItems();
+}
+
+
+void Vic2::SaveReader::findItems()
+{
+	std::string_view text(contents);
+	if (text.starts_with(utf8BOM))
+	{
+		text.remove_prefix(utf8BOM.size());
+	}
+
+	Lexer lexer(text);
+	while (true)
+	{
+		lexer.skipWhitespaceAndComments();
+		if (lexer.atEnd())
+		{
+			break;
+		}
+
+		// stray braces, values without keys, and quoted keys are not anything the converter uses
+		if ((lexer.peek() == '}') || (lexer.peek() == '='))
+		{
+			lexer.advance();
+			continue;
+		}
+		if (lexer.peek() == '{')
+		{
+			lexer.skipBlock();
+			continue;
+		}
+		if (lexer.peek() == '"')
+		{
+			lexer.skipQuotedString();
+			lexer.skipWhitespaceAndComments();
+			if (!lexer.atEnd() && (lexer.peek() == '='))
+			{
+				lexer.advance();
+				lexer.skipWhitespaceAndComments();
+				lexer.skipValue();
+			}
+			continue;
+		}
+
+		const auto key = lexer.readBareToken();
+		const auto valueStart = lexer.getPosition();
+		lexer.skipWhitespaceAndComments();
+		if (lexer.atEnd())
+		{
+			break;
+		}
+		if (lexer.peek() == '=')
+		{
+			lexer.advance();
+			lexer.skipWhitespaceAndComments();
+		}
+		else if (lexer.peek() != '{')
+		{
+			// a key on its own
+			continue;
+		}
+		lexer.skipValue();
+
+		if (const auto type = classifyKey(key); type)
+		{
+			items.push_back(Item{*type, key, text.substr(valueStart, lexer.getPosition() - valueStart)});
+		}
+	}
+}
+
+
+Vic2::MemoryStream::MemoryStream(const std::string_view text): std::istream(nullptr), buffer(text)
+{
+	rdbuf(&buffer);
+}
+
+
+Vic2::MemoryStream::Buffer::Buffer(const std::string_view text)
+{
+	// the buffer is only ever read, but streambuf wants non-const pointers
+	auto* begin = const_cast<char*>(text.data());
+	setg(begin, begin, begin + text.size());
+}
+
+
+std::streambuf::pos_type Vic2::MemoryStream::Buffer::seekoff(const off_type offset,
+	 const std::ios_base::seekdir direction,
+	 const std::ios_base::openmode which)
+{
+	if (!(which & std::ios_base::in))
+	{
+		return {off_type(-1)};
+	}
+
+	off_type base = 0;
+	if (direction == std::ios_base::cur)
+	{
+		base = gptr() - eback();
+	}
+	else if (direction == std::ios_base::end)
+	{
+		base = egptr() - eback();
+	}
+
+	const auto newPosition = base + offset;
+	if ((newPosition < 0) || (newPosition > egptr() - eback()))
+	{
+		return {off_type(-1)};
+	}
+	setg(eback(), eback() + newPosition, egptr());
+	return {newPosition};
+}
+
+
+std::streambuf::pos_type Vic2::MemoryStream::Buffer::seekpos(const pos_type position,
+	 const std::ios_base::openmode which)
+{
+	return seekoff(off_type(position), std::ios_base::beg, which);
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+#ifndef VIC2_SAVE_READER_H
+#define VIC2_SAVE_READER_H
+
+
+
+#include <istream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+
+namespace Vic2
+{
+
+// Finds the top-level items of a save that the converter uses. Saves can be hundreds of megabytes, so rather than
+// matching every key against regexes, the file is read into memory once and split up by a small lexer that only
+// tracks quotes, comments, and brace depth. Each item is handed out as a view into the file.
+class SaveReader
+{
+  public:
+	enum class ItemType
+	{
+		Province,
+		Country,
+		Date,
+		GreatNations,
+		Diplomacy,
+		ActiveWar
+	};
+
+	struct Item
+	{
+		ItemType type;
+		std::string_view key;
+		std::string_view value; // everything after the key, starting with the equals sign
+	};
+
+	explicit SaveReader(const std::string& filename);
+	SaveReader(const SaveReader&) = delete;
+	SaveReader& operator=(const SaveReader&) = delete;
+
+	[[nodiscard]] const auto& getItems() const { return items; }
+
+  private:
+	void findItems();
+
+	std::string contents;
+	std::vector<Item> items;
+};
+
+
+// An input stream over text that is already in memory, so save items can be given to the parsers without copying
+class MemoryStream: public std::istream
+{
+  public:
+	explicit MemoryStream(std::string_view text);
+
+  private:
+	class Buffer: public std::streambuf
+	{
+	  public:
+		explicit Buffer(std::string_view text);
+
+	  protected:
+		pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which) override;
+		pos_type seekpos(pos_type position, std::ios_base::openmode which) override;
+	};
+
+	Buffer buffer;
+};
+
+} // namespace Vic2
+
+
+
+#endif // VIC2_SAVE_READER_H
\ No newline at end of file
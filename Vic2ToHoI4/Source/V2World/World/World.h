@@ -6,6 +6,7 @@
 #include "Parser.h"
 #include "V2World/Countries/Country.h"
 #include "V2World/Diplomacy/Diplomacy.h"
+#include "V2World/Issues/Issues.h"
 #include "V2World/Localisations/Vic2Localisations.h"
 #include "V2World/Provinces/Province.h"
 #include "V2World/States/StateDefinitions.h"
@@ -36,14 +37,16 @@ class World
 	[[nodiscard]] const auto& getGreatPowers() const { return greatPowers; }
 	[[nodiscard]] const auto& getStateDefinitions() const { return *theStateDefinitions; }
 	[[nodiscard]] const auto& getLocalisations() const { return *theLocalisations; }
+	[[nodiscard]] const auto& getIssues() const { return theIssues; }
 
   private:
 	std::map<int, std::shared_ptr<Province>> provinces;
 	std::map<std::string, Country> countries;
 	std::unique_ptr<Diplomacy> diplomacy;
 	std::vector<std::string> greatPowers;
-	std::unique_ptr<StateDefinitions> theStateDefinitions;
+	std::shared_ptr<StateDefinitions> theStateDefinitions;
 	std::unique_ptr<Localisations> theLocalisations;
+	Issues theIssues;
 };
 
 
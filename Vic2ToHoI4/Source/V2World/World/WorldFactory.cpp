@@ -1,25 +1,31 @@
 #include "WorldFactory.h"
-#include "CommonRegexes.h"
 #include "Log.h"
 #include "Mappers/MergeRules/MergeRules.h"
 #include "Mappers/MergeRules/MergeRulesFactory.h"
+#include "ParallelFor.h"
 #include "ParserHelpers.h"
 #include "V2World/Countries/CommonCountriesDataFactory.h"
 #include "V2World/Culture/CultureGroupsFactory.h"
 #include "V2World/Issues/IssuesFactory.h"
 #include "V2World/Localisations/LocalisationsFactory.h"
+#include "V2World/Military/Leaders/TraitsFactory.h"
+#include "V2World/ParseWarning.h"
 #include "V2World/Pops/PopFactory.h"
+#include "V2World/Pops/PopStore.h"
 #include "V2World/States/StateDefinitionsFactory.h"
 #include "V2World/States/StateLanguageCategoriesFactory.h"
+#include "V2World/Technology/InventionsFactory.h"
+#include <exception>
+#include <mutex>
 
 
 
 Vic2::World::Factory::Factory(const Configuration& theConfiguration):
 	 theCultureGroups(CultureGroups::Factory().getCultureGroups(theConfiguration)),
 	 theIssues(Issues::Factory().getIssues(theConfiguration.getVic2Path())),
-	 provinceFactory(std::make_unique<Province::Factory>(std::make_unique<Pop::Factory>(*theIssues))),
 	 theStateDefinitions(StateDefinitions::Factory().getStateDefinitions(theConfiguration)),
-	 countryFactory(std::make_unique<Country::Factory>(theConfiguration, *theStateDefinitions, theCultureGroups)),
+	 theInventions(Inventions::Factory().loadInventions(theConfiguration)),
+	 theTraits(Traits::Factory().loadTraits(theConfiguration.getVic2Path())),
 	 stateLanguageCategories(StateLanguageCategories::Factory().getCategories()),
 	 diplomacyFactory(std::make_unique<Diplomacy::Factory>())
 {
@@ -27,45 +33,6 @@ Vic2::World::Factory::Factory(const Configuration& theConfiguration):
 	commonCountriesData = commonCountriesData_;
 	allParties = allParties_;
 	countriesData = CountriesData::Factory().importCountriesData(theConfiguration);
-
-	registerKeyword("date", [](std::istream& theStream) {
-		const date theDate{commonItems::singleString{theStream}.getString()};
-		Log(LogLevel::Info) << "The date is " << theDate;
-	});
-	registerKeyword("great_nations", [this](std::istream& theStream) {
-		greatPowerIndexes = commonItems::intList{theStream}.getInts();
-	});
-	registerRegex(R"(\d+)", [this](const std::string& provinceID, std::istream& theStream) {
-		const auto provinceNum = std::stoi(provinceID); // the regex ensures the ID is always a valid number
-		world->provinces[provinceNum] = provinceFactory->getProvince(provinceNum, theStream);
-	});
-	registerRegex("[A-Z][A-Z0-9]{2}", [this, theConfiguration](const std::string& countryTag, std::istream& theStream) {
-		if (const auto commonCountryData = commonCountriesData.find(countryTag);
-			 commonCountryData != commonCountriesData.end())
-		{
-			world->countries.emplace(countryTag,
-				 *countryFactory->createCountry(countryTag,
-					  theStream,
-					  commonCountryData->second,
-					  allParties,
-					  *stateLanguageCategories,
-					  theConfiguration.getPercentOfCommanders(),
-					  countriesData->getCountryData(countryTag)));
-			tagsInOrder.push_back(countryTag);
-		}
-		else
-		{
-			Log(LogLevel::Warning) << "Invalid tag " << countryTag;
-			commonItems::ignoreItem(countryTag, theStream);
-		}
-	});
-	registerKeyword("diplomacy", [this](std::istream& theStream) {
-		world->diplomacy = diplomacyFactory->getDiplomacy(theStream);
-	});
-	registerKeyword("active_war", [this](std::istream& theStream) {
-		wars.push_back(*warFactory.getWar(theStream));
-	});
-	registerRegex(commonItems::catchallRegex, commonItems::ignoreItem);
 }
 
 
@@ -81,9 +48,10 @@ std::unique_ptr<Vic2::World> Vic2::World::Factory::importWorld(const Configurati
 	wars.clear();
 
 	world = std::make_unique<World>();
-	world->theStateDefinitions = StateDefinitions::Factory().getStateDefinitions(theConfiguration);
+	world->theStateDefinitions = theStateDefinitions;
 	world->theLocalisations = Localisations::Factory().importLocalisations(theConfiguration);
-	parseFile(theConfiguration.getInputFile());
+	world->theIssues = *theIssues;
+	importSave(theConfiguration);
 	if (!world->diplomacy)
 	{
 		Log(LogLevel::Warning) << "Vic2 save had no diplomacy section!";
@@ -113,6 +81,148 @@ std::unique_ptr<Vic2::World> Vic2::World::Factory::importWorld(const Configurati
 }
 
 
+void Vic2::World::Factory::importSave(const Configuration& theConfiguration)
+{
+	const SaveReader save(theConfiguration.getInputFile());
+
+	// Provinces and countries are most of a save and don't depend on each other, so they're parsed on several threads.
+	// They're added to the world in save order afterwards, just as if they'd been parsed one at a time.
+	std::vector<const SaveReader::Item*> blocks;
+	for (const auto& item: save.getItems())
+	{
+		if (item.type == SaveReader::ItemType::Province)
+		{
+			blocks.push_back(&item);
+			continue;
+		}
+		if (item.type == SaveReader::ItemType::Country)
+		{
+			if (commonCountriesData.contains(std::string(item.key)))
+			{
+				blocks.push_back(&item);
+			}
+			else
+			{
+				Log(LogLevel::Warning) << "Invalid tag " << item.key;
+			}
+			continue;
+		}
+
+		MemoryStream theStream(item.value);
+		if (item.type == SaveReader::ItemType::Date)
+		{
+			const date theDate{commonItems::singleString{theStream}.getString()};
+			Log(LogLevel::Info) << "The date is " << theDate;
+		}
+		else if (item.type == SaveReader::ItemType::GreatNations)
+		{
+			greatPowerIndexes = commonItems::intList{theStream}.getInts();
+		}
+		else if (item.type == SaveReader::ItemType::Diplomacy)
+		{
+			world->diplomacy = diplomacyFactory->getDiplomacy(theStream);
+		}
+		else if (item.type == SaveReader::ItemType::ActiveWar)
+		{
+			wars.push_back(*warFactory.getWar(theStream));
+		}
+	}
+
+	std::vector<ParsedBlock> parsedBlocks(blocks.size());
+	std::exception_ptr parseError;
+	try
+	{
+		parseBlocks(blocks, parsedBlocks, theConfiguration);
+	}
+	catch (...)
+	{
+		parseError = std::current_exception();
+	}
+
+	// warnings are logged in save order, and even if parsing failed, as they may explain why
+	for (const auto& parsedBlock: parsedBlocks)
+	{
+		for (const auto& warning: parsedBlock.warnings)
+		{
+			Log(LogLevel::Warning) << warning;
+		}
+	}
+	if (parseError)
+	{
+		std::rethrow_exception(parseError);
+	}
+
+	// each province was parsed with a pop store of its own, and now moves its pops into the one for the whole world
+	const auto popStore = std::make_shared<PopStore>();
+	for (size_t block = 0; block < blocks.size(); block++)
+	{
+		if (auto& province = parsedBlocks[block].province; province)
+		{
+			province->movePopsTo(popStore);
+			world->provinces[std::stoi(std::string(blocks[block]->key))] = std::move(province);
+		}
+		else
+		{
+			const std::string countryTag(blocks[block]->key);
+			world->countries.emplace(countryTag, std::move(*parsedBlocks[block].country));
+			tagsInOrder.push_back(countryTag);
+		}
+	}
+}
+
+
+void Vic2::World::Factory::parseBlocks(const std::vector<const SaveReader::Item*>& blocks,
+	 std::vector<ParsedBlock>& parsedBlocks,
+	 const Configuration& theConfiguration)
+{
+	// Factories keep the item they're building, so each block borrows a set no other thread is using. New sets are only
+	// made while every existing one is busy, so there are never more sets than threads.
+	struct BlockFactories
+	{
+		std::unique_ptr<Province::Factory> provinceFactory;
+		std::unique_ptr<Country::Factory> countryFactory;
+	};
+	std::mutex idleFactoriesMutex;
+	std::vector<BlockFactories> idleFactories;
+	const auto borrowFactories = [&]() -> BlockFactories {
+		if (std::scoped_lock lock(idleFactoriesMutex); !idleFactories.empty())
+		{
+			auto factories = std::move(idleFactories.back());
+			idleFactories.pop_back();
+			return factories;
+		}
+		return {std::make_unique<Province::Factory>(std::make_unique<Pop::Factory>(*theIssues)),
+			 std::make_unique<Country::Factory>(theInventions, theTraits, *theStateDefinitions, theCultureGroups)};
+	};
+
+	forEachInParallel(blocks.size(), theConfiguration.getNumberOfThreads(), [&](const size_t block) {
+		auto factories = borrowFactories();
+		ParseWarningCollector warningCollector(parsedBlocks[block].warnings);
+		MemoryStream theStream(blocks[block]->value);
+		if (blocks[block]->type == SaveReader::ItemType::Province)
+		{
+			// the reader ensures the key is always a valid number
+			const auto provinceNum = std::stoi(std::string(blocks[block]->key));
+			parsedBlocks[block].province = factories.provinceFactory->getProvince(provinceNum, theStream);
+		}
+		else
+		{
+			const std::string countryTag(blocks[block]->key);
+			parsedBlocks[block].country = factories.countryFactory->createCountry(countryTag,
+				 theStream,
+				 commonCountriesData.at(countryTag),
+				 allParties,
+				 *stateLanguageCategories,
+				 theConfiguration.getPercentOfCommanders(),
+				 countriesData->getCountryData(countryTag));
+		}
+
+		std::scoped_lock lock(idleFactoriesMutex);
+		idleFactories.push_back(std::move(factories));
+	});
+}
+
+
 void Vic2::World::Factory::setGreatPowerStatus()
 {
 	Log(LogLevel::Info) << "\tSetting Great Power statuses";
@@ -163,10 +273,9 @@ void Vic2::World::Factory::addProvinceCoreInfoToCountries()
 	Log(LogLevel::Info) << "\tAssigning cores to countries";
 	for (const auto& [unused, province]: world->provinces)
 	{
-		auto provinceCores = province->getCores();
-		for (const auto& coreCountryString: provinceCores)
+		for (const auto core: province->getCores())
 		{
-			auto coreCountry = world->countries.find(coreCountryString);
+			auto coreCountry = world->countries.find(core.toString());
 			if (coreCountry != world->countries.end())
 			{
 				coreCountry->second.addCore(province);
@@ -179,6 +288,11 @@ void Vic2::World::Factory::addProvinceCoreInfoToCountries()
 void Vic2::World::Factory::removeSimpleLandlessNations()
 {
 	Log(LogLevel::Info) << "\tRemoving simple landless nations";
+	for (auto& [unused, province]: world->provinces)
+	{
+		province->indexCultures(*theCultureGroups);
+	}
+
 	for (auto& [tag, country]: world->countries)
 	{
 		if (country.hasLand())
@@ -186,10 +300,11 @@ void Vic2::World::Factory::removeSimpleLandlessNations()
 			continue;
 		}
 
+		const auto acceptedCultures = theCultureGroups->addCultures(country.getAcceptedCultures());
 		std::vector<std::shared_ptr<Province>> coresToKeep;
 		for (auto& core: country.getCores())
 		{
-			if (shouldCoreBeRemoved(*core, country))
+			if (shouldCoreBeRemoved(*core, country, acceptedCultures))
 			{
 				core->removeCore(tag);
 			}
@@ -209,7 +324,9 @@ void Vic2::World::Factory::removeSimpleLandlessNations()
 
 
 constexpr double ACCEPTED_CULTURE_THRESHOLD = 0.25;
-bool Vic2::World::Factory::shouldCoreBeRemoved(const Province& core, const Country& country) const
+bool Vic2::World::Factory::shouldCoreBeRemoved(const Province& core,
+	 const Country& country,
+	 const CultureSet& acceptedCultures) const
 {
 	if (core.getOwner().empty())
 	{
@@ -229,7 +346,7 @@ bool Vic2::World::Factory::shouldCoreBeRemoved(const Province& core, const Count
 	{
 		return true;
 	}
-	if (core.getPercentageWithCultures(country.getAcceptedCultures()) < ACCEPTED_CULTURE_THRESHOLD)
+	if (core.getPercentageWithCultures(acceptedCultures) < ACCEPTED_CULTURE_THRESHOLD)
 	{
 		return true;
 	}
@@ -5,7 +5,7 @@
 
 #include "Configuration.h"
 #include "Mappers/Provinces/ProvinceMapper.h"
-#include "Parser.h"
+#include "SaveReader.h"
 #include "V2World/Countries/CountryFactory.h"
 #include "V2World/Culture/CultureGroups.h"
 #include "V2World/Diplomacy/DiplomacyFactory.h"
@@ -15,13 +15,15 @@
 #include "V2World/Wars/WarFactory.h"
 #include "World.h"
 #include <memory>
+#include <string>
+#include <vector>
 
 
 
 namespace Vic2
 {
 
-class World::Factory: commonItems::parser
+class World::Factory
 {
   public:
 	explicit Factory(const Configuration& theConfiguration);
@@ -29,12 +31,26 @@ class World::Factory: commonItems::parser
 		 const Mappers::ProvinceMapper& provinceMapper);
 
   private:
+	// a province or country from the save, parsed but not yet added to the world
+	struct ParsedBlock
+	{
+		std::unique_ptr<Province> province;
+		std::unique_ptr<Country> country;
+		std::vector<std::string> warnings;
+	};
+
+	void importSave(const Configuration& theConfiguration);
+	void parseBlocks(const std::vector<const SaveReader::Item*>& blocks,
+		 std::vector<ParsedBlock>& parsedBlocks,
+		 const Configuration& theConfiguration);
 	void setLocalisations(Localisations& vic2Localisations);
 	void setGreatPowerStatus();
 	void setProvinceOwners();
 	void addProvinceCoreInfoToCountries();
 	void removeSimpleLandlessNations();
-	[[nodiscard]] bool shouldCoreBeRemoved(const Province& core, const Country& country) const;
+	[[nodiscard]] bool shouldCoreBeRemoved(const Province& core,
+		 const Country& country,
+		 const CultureSet& acceptedCultures) const;
 	void determineEmployedWorkers();
 	void removeEmptyNations();
 	void addWarsToCountries(const std::vector<War>& wars);
@@ -55,10 +71,10 @@ class World::Factory: commonItems::parser
 
 	std::shared_ptr<CultureGroups> theCultureGroups;
 	std::unique_ptr<Issues> theIssues;
-	std::unique_ptr<Province::Factory> provinceFactory;
 	War::Factory warFactory;
-	std::unique_ptr<StateDefinitions> theStateDefinitions;
-	std::unique_ptr<Country::Factory> countryFactory;
+	std::shared_ptr<StateDefinitions> theStateDefinitions; // loaded once and shared with every imported world
+	std::shared_ptr<const Inventions> theInventions; // read once and shared by every country factory
+	std::shared_ptr<const Traits> theTraits;
 	std::unique_ptr<StateLanguageCategories> stateLanguageCategories;
 	std::unique_ptr<Diplomacy::Factory> diplomacyFactory;
 	std::map<std::string, CommonCountryData> commonCountriesData;
@@ -790,4 +790,93 @@ TEST(ConfigurationTests, PercentOfCommandersCanBeSet)
 	const auto theConfiguration = Configuration::Factory().importConfiguration(input);
 
 	ASSERT_EQ(0.05F, theConfiguration->getPercentOfCommanders());
+}
+
+
+TEST(ConfigurationTests, NumberOfThreadsDefaultsToZero)
+{
+	std::stringstream input;
+	const auto theConfiguration = Configuration::Factory().importConfiguration(input);
+
+	ASSERT_EQ(0, theConfiguration->getNumberOfThreads());
+}
+
+
+TEST(ConfigurationTests, NumberOfThreadsCanBeSet)
+{
+	std::stringstream input;
+	input << R"(threads = "4")";
+	const auto theConfiguration = Configuration::Factory().importConfiguration(input);
+
+	ASSERT_EQ(4, theConfiguration->getNumberOfThreads());
+}
+
+
+TEST(ConfigurationTests, NegativeNumberOfThreadsBecomesZero)
+{
+	std::stringstream input;
+	input << R"(threads = "-2")";
+	const auto theConfiguration = Configuration::Factory().importConfiguration(input);
+
+	ASSERT_EQ(0, theConfiguration->getNumberOfThreads());
+}
+
+
+TEST(ConfigurationTests, CacheMapDataDefaultsToYes)
+{
+	std::stringstream input;
+	const auto theConfiguration = Configuration::Factory().importConfiguration(input);
+
+	ASSERT_TRUE(theConfiguration->getCacheMapData());
+}
+
+
+TEST(ConfigurationTests, CacheMapDataCanBeSetToNo)
+{
+	std::stringstream input;
+	input << R"(cache_map_data = "no")";
+	const auto theConfiguration = Configuration::Factory().importConfiguration(input);
+
+	ASSERT_FALSE(theConfiguration->getCacheMapData());
+}
+
+
+TEST(ConfigurationTests, CacheMapDataCanBeSetToYes)
+{
+	std::stringstream input;
+	input << "cache_map_data = \"no\"\n";
+	input << R"(cache_map_data = "yes")";
+	const auto theConfiguration = Configuration::Factory().importConfiguration(input);
+
+	ASSERT_TRUE(theConfiguration->getCacheMapData());
+}
+
+
+TEST(ConfigurationTests, CacheFlagsDefaultsToYes)
+{
+	std::stringstream input;
+	const auto theConfiguration = Configuration::Factory().importConfiguration(input);
+
+	ASSERT_TRUE(theConfiguration->getCacheFlags());
+}
+
+
+TEST(ConfigurationTests, CacheFlagsCanBeSetToNo)
+{
+	std::stringstream input;
+	input << R"(cache_flags = "no")";
+	const auto theConfiguration = Configuration::Factory().importConfiguration(input);
+
+	ASSERT_FALSE(theConfiguration->getCacheFlags());
+}
+
+
+TEST(ConfigurationTests, CacheFlagsCanBeSetToYes)
+{
+	std::stringstream input;
+	input << "cache_flags = \"no\"\n";
+	input << R"(cache_flags = "yes")";
+	const auto theConfiguration = Configuration::Factory().importConfiguration(input);
+
+	ASSERT_TRUE(theConfiguration->getCacheFlags());
 }
\ No newline at end of file
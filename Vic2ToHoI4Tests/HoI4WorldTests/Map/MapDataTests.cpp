@@ -0,0 +1,157 @@
+#include "HOI4World/Map/MapData.h"
+#include "HOI4World/ProvinceDefinitions.h"
+#include "gtest/gtest.h"
+#include <cstdio>
+#include <fstream>
+
+
+
+TEST(HoI4World_Map_MapData, ProvincesAreFoundOnMap)
+{
+	const auto configuration =
+		 Configuration::Builder().setHoI4Path("./MapData").setNumberOfThreads(1).setCacheMapData(false).build();
+	const auto provinceDefinitions = HoI4::ProvinceDefinitions::Importer().importProvinceDefinitions(*configuration);
+	const HoI4::MapData mapData(provinceDefinitions, *configuration);
+
+	for (auto province = 1; province <= 11; province++)
+	{
+		ASSERT_NE(nullptr, mapData.getProvincePoints(province));
+		ASSERT_FALSE(mapData.getNeighbors(province).empty());
+	}
+}
+
+
+TEST(HoI4World_Map_MapData, UndefinedColorsAreNotProvinces)
+{
+	const auto configuration =
+		 Configuration::Builder().setHoI4Path("./MapData").setNumberOfThreads(1).setCacheMapData(false).build();
+	const auto provinceDefinitions = HoI4::ProvinceDefinitions::Importer().importProvinceDefinitions(*configuration);
+	const HoI4::MapData mapData(provinceDefinitions, *configuration);
+
+	ASSERT_EQ(nullptr, mapData.getProvincePoints(0));
+	ASSERT_EQ(nullptr, mapData.getProvincePoints(12));
+	ASSERT_FALSE(mapData.getProvinceCenter(0));
+	ASSERT_FALSE(mapData.getProvinceCenter(12));
+	ASSERT_TRUE(mapData.getNeighbors(12).empty());
+	for (auto province = 1; province <= 11; province++)
+	{
+		ASSERT_FALSE(mapData.getNeighbors(province).contains(0));
+	}
+}
+
+
+TEST(HoI4World_Map_MapData, ProvinceCentersAreCentermostPoints)
+{
+	const auto configuration =
+		 Configuration::Builder().setHoI4Path("./MapData").setNumberOfThreads(1).setCacheMapData(false).build();
+	const auto provinceDefinitions = HoI4::ProvinceDefinitions::Importer().importProvinceDefinitions(*configuration);
+	const HoI4::MapData mapData(provinceDefinitions, *configuration);
+
+	for (auto province = 1; province <= 11; province++)
+	{
+		ASSERT_EQ(mapData.getProvincePoints(province)->getCentermostPoint(), mapData.getProvinceCenter(province));
+	}
+}
+
+
+TEST(HoI4World_Map_MapData, ParallelConstructionMatchesSerialConstruction)
+{
+	const auto serialConfiguration =
+		 Configuration::Builder().setHoI4Path("./MapData").setNumberOfThreads(1).setCacheMapData(false).build();
+	const auto parallelConfiguration =
+		 Configuration::Builder().setHoI4Path("./MapData").setNumberOfThreads(4).setCacheMapData(false).build();
+	const auto provinceDefinitions =
+		 HoI4::ProvinceDefinitions::Importer().importProvinceDefinitions(*serialConfiguration);
+
+	const HoI4::MapData serialMapData(provinceDefinitions, *serialConfiguration);
+	const HoI4::MapData parallelMapData(provinceDefinitions, *parallelConfiguration);
+
+	for (auto province = 1; province <= 11; province++)
+	{
+		ASSERT_EQ(serialMapData.getNeighbors(province), parallelMapData.getNeighbors(province));
+		ASSERT_EQ(serialMapData.getAnyBorderCenter(province), parallelMapData.getAnyBorderCenter(province));
+		for (const auto neighbor: serialMapData.getNeighbors(province))
+		{
+			ASSERT_EQ(serialMapData.getSpecifiedBorderCenter(province, neighbor),
+				 parallelMapData.getSpecifiedBorderCenter(province, neighbor));
+		}
+		ASSERT_EQ(serialMapData.getProvincePoints(province)->getCentermostPoint(),
+			 parallelMapData.getProvincePoints(province)->getCentermostPoint());
+	}
+	for (auto y = 0; y < 32; y++)
+	{
+		for (auto x = 0; x < 48; x++)
+		{
+			ASSERT_EQ(serialMapData.getProvinceNumber(x, y), parallelMapData.getProvinceNumber(x, y));
+		}
+	}
+}
+
+
+TEST(HoI4World_Map_MapData, CachedMapDataMatchesImportedMapData)
+{
+	std::remove("map_data.cache");
+	const auto uncachedConfiguration =
+		 Configuration::Builder().setHoI4Path("./MapData").setCacheMapData(false).build();
+	const auto cachedConfiguration = Configuration::Builder().setHoI4Path("./MapData").setCacheMapData(true).build();
+	const auto provinceDefinitions =
+		 HoI4::ProvinceDefinitions::Importer().importProvinceDefinitions(*uncachedConfiguration);
+
+	const HoI4::MapData importedMapData(provinceDefinitions, *uncachedConfiguration);
+	ASSERT_FALSE(std::ifstream("map_data.cache").is_open());
+	const HoI4::MapData cacheWritingMapData(provinceDefinitions, *cachedConfiguration);
+	ASSERT_TRUE(std::ifstream("map_data.cache").is_open());
+	const HoI4::MapData cachedMapData(provinceDefinitions, *cachedConfiguration);
+
+	for (auto province = 1; province <= 11; province++)
+	{
+		ASSERT_EQ(importedMapData.getNeighbors(province), cachedMapData.getNeighbors(province));
+		ASSERT_EQ(importedMapData.getAnyBorderCenter(province), cachedMapData.getAnyBorderCenter(province));
+		for (const auto neighbor: importedMapData.getNeighbors(province))
+		{
+			ASSERT_EQ(importedMapData.getSpecifiedBorderCenter(province, neighbor),
+				 cachedMapData.getSpecifiedBorderCenter(province, neighbor));
+		}
+		ASSERT_EQ(importedMapData.getProvincePoints(province)->getCentermostPoint(),
+			 cachedMapData.getProvincePoints(province)->getCentermostPoint());
+		ASSERT_EQ(importedMapData.getProvinceCenter(province), cachedMapData.getProvinceCenter(province));
+	}
+	for (auto y = 0; y < 32; y++)
+	{
+		for (auto x = 0; x < 48; x++)
+		{
+			ASSERT_EQ(importedMapData.getProvinceNumber(x, y), cachedMapData.getProvinceNumber(x, y));
+		}
+	}
+	std::remove("map_data.cache");
+}
+
+
+TEST(HoI4World_Map_MapData, DamagedCacheIsIgnored)
+{
+	{
+		std::ofstream cache("map_data.cache", std::ios::binary);
+		cache << "V2H4MAPS not really a cache";
+	}
+	const auto uncachedConfiguration =
+		 Configuration::Builder().setHoI4Path("./MapData").setCacheMapData(false).build();
+	const auto cachedConfiguration = Configuration::Builder().setHoI4Path("./MapData").setCacheMapData(true).build();
+	const auto provinceDefinitions =
+		 HoI4::ProvinceDefinitions::Importer().importProvinceDefinitions(*uncachedConfiguration);
+
+	const HoI4::MapData importedMapData(provinceDefinitions, *uncachedConfiguration);
+	const HoI4::MapData cachedMapData(provinceDefinitions, *cachedConfiguration);
+
+	for (auto province = 1; province <= 11; province++)
+	{
+		ASSERT_EQ(importedMapData.getNeighbors(province), cachedMapData.getNeighbors(province));
+	}
+	for (auto y = 0; y < 32; y++)
+	{
+		for (auto x = 0; x < 48; x++)
+		{
+			ASSERT_EQ(importedMapData.getProvinceNumber(x, y), cachedMapData.getProvinceNumber(x, y));
+		}
+	}
+	std::remove("map_data.cache");
+}
\ No newline at end of file
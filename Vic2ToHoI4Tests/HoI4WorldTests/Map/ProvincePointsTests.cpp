@@ -1,5 +1,8 @@
 #include "HOI4World/Map/ProvincePoints.h"
 #include "gtest/gtest.h"
+#include <algorithm>
+#include <random>
+#include <vector>
 
 
 
@@ -47,4 +50,86 @@ TEST(HoI4World_Map_ProvincePoints, CentermostPointWhenCenterNotControlled)
 
 	const point expectedPoint{3, 0};
 	ASSERT_EQ(expectedPoint, provincePoints.getCentermostPoint());
+}
+
+
+TEST(HoI4World_Map_ProvincePoints, CentermostPointIsFoundAcrossRows)
+{
+	HoI4::ProvincePoints provincePoints;
+	provincePoints.addPoint(point{0, 0});
+	provincePoints.addPoint(point{1, 0});
+	provincePoints.addPoint(point{2, 0});
+	provincePoints.addPoint(point{6, 4});
+	provincePoints.addPoint(point{7, 4});
+	provincePoints.addPoint(point{8, 4});
+
+	const point expectedPoint{2, 0};
+	ASSERT_EQ(expectedPoint, provincePoints.getCentermostPoint());
+}
+
+
+TEST(HoI4World_Map_ProvincePoints, CentermostPointTiesGoToLowestPoint)
+{
+	HoI4::ProvincePoints provincePoints;
+	provincePoints.addPoint(point{2, 1});
+	provincePoints.addPoint(point{0, 1});
+
+	const point expectedPoint{0, 1};
+	ASSERT_EQ(expectedPoint, provincePoints.getCentermostPoint());
+}
+
+
+TEST(HoI4World_Map_ProvincePoints, CentermostPointIsFoundWhenRowsDescend)
+{
+	HoI4::ProvincePoints provincePoints;
+	provincePoints.addSpan(8, 0, 1);
+	provincePoints.addSpan(8, 9, 10);
+	provincePoints.addSpan(4, 0, 0);
+	provincePoints.addSpan(4, 10, 10);
+	provincePoints.addSpan(0, 0, 10);
+
+	const point expectedPoint{5, 0};
+	ASSERT_EQ(expectedPoint, provincePoints.getCentermostPoint());
+}
+
+
+TEST(HoI4World_Map_ProvincePoints, CentermostPointDoesNotDependOnSpanOrder)
+{
+	std::mt19937 generator(1234);
+	for (auto trial = 0; trial < 200; trial++)
+	{
+		std::vector<HoI4::ProvincePoints::Span> spans;
+		const auto numRows = std::uniform_int_distribution(1, 40)(generator);
+		for (auto y = 0; y < numRows; y++)
+		{
+			auto x = std::uniform_int_distribution(0, 20)(generator);
+			const auto numSpans = std::uniform_int_distribution(0, 3)(generator);
+			for (auto span = 0; span < numSpans; span++)
+			{
+				const auto width = std::uniform_int_distribution(0, 15)(generator);
+				spans.push_back({y, x, x + width});
+				x += width + 2 + std::uniform_int_distribution(0, 10)(generator);
+			}
+		}
+
+		HoI4::ProvincePoints ascendingPoints;
+		for (const auto& span: spans)
+		{
+			ascendingPoints.addSpan(span.y, span.leftX, span.rightX);
+		}
+		HoI4::ProvincePoints descendingPoints;
+		for (auto span = spans.rbegin(); span != spans.rend(); ++span)
+		{
+			descendingPoints.addSpan(span->y, span->leftX, span->rightX);
+		}
+		std::shuffle(spans.begin(), spans.end(), generator);
+		HoI4::ProvincePoints shuffledPoints;
+		for (const auto& span: spans)
+		{
+			shuffledPoints.addSpan(span.y, span.leftX, span.rightX);
+		}
+
+		ASSERT_EQ(shuffledPoints.getCentermostPoint(), ascendingPoints.getCentermostPoint());
+		ASSERT_EQ(shuffledPoints.getCentermostPoint(), descendingPoints.getCentermostPoint());
+	}
 }
\ No newline at end of file
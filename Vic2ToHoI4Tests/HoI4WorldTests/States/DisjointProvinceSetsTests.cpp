@@ -0,0 +1,152 @@
+#include "HOI4World/States/DisjointProvinceSets.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <queue>
+#include <utility>
+
+
+
+TEST(HoI4World_States_DisjointProvinceSets, ProvincesStartInSetsOfTheirOwn)
+{
+	const HoI4::DisjointProvinceSets sets({3, 1, 2});
+
+	const std::vector<std::set<int>> expectedSets{{1}, {2}, {3}};
+	ASSERT_EQ(expectedSets, sets.getSets());
+}
+
+
+TEST(HoI4World_States_DisjointProvinceSets, JoinedProvincesShareASet)
+{
+	HoI4::DisjointProvinceSets sets({1, 2, 3, 4, 5});
+	sets.join(1, 4);
+	sets.join(5, 2);
+	sets.join(4, 3);
+
+	const std::vector<std::set<int>> expectedSets{{1, 3, 4}, {2, 5}};
+	ASSERT_EQ(expectedSets, sets.getSets());
+}
+
+
+TEST(HoI4World_States_DisjointProvinceSets, ProvincesOutsideTheSetsAreIgnored)
+{
+	HoI4::DisjointProvinceSets sets({1, 3});
+	sets.join(1, 2);
+	sets.join(2, 3);
+
+	ASSERT_TRUE(sets.contains(1));
+	ASSERT_FALSE(sets.contains(2));
+	const std::vector<std::set<int>> expectedSets{{1}, {3}};
+	ASSERT_EQ(expectedSets, sets.getSets());
+}
+
+
+TEST(HoI4World_States_DisjointProvinceSets, EmptySetsHaveNoSets)
+{
+	const HoI4::DisjointProvinceSets sets({});
+
+	ASSERT_TRUE(sets.getSets().empty());
+}
+
+
+// Run with --gtest_also_run_disabled_tests to compare against the search that flooded every land province
+TEST(HoI4World_States_DisjointProvinceSets, DISABLED_BenchmarkFragmentedStates)
+{
+	// A continent of land provinces in a square grid, split into states of four provinces. Each state also has an
+	// island enclave, so a search that can leave the state never finds everything and floods the whole continent.
+	constexpr auto width = 60;
+	constexpr auto numContinentProvinces = width * width;
+	std::map<int, std::set<int>> neighbors;
+	for (auto y = 0; y < width; y++)
+	{
+		for (auto x = 0; x < width; x++)
+		{
+			auto& provinceNeighbors = neighbors[y * width + x + 1];
+			if (x > 0)
+			{
+				provinceNeighbors.insert(y * width + x);
+			}
+			if (x < width - 1)
+			{
+				provinceNeighbors.insert(y * width + x + 2);
+			}
+			if (y > 0)
+			{
+				provinceNeighbors.insert((y - 1) * width + x + 1);
+			}
+			if (y < width - 1)
+			{
+				provinceNeighbors.insert((y + 1) * width + x + 1);
+			}
+		}
+	}
+	std::vector<std::set<int>> states;
+	for (auto y = 0; y < width; y += 2)
+	{
+		for (auto x = 0; x < width; x += 2)
+		{
+			const auto province = y * width + x + 1;
+			const auto island = numContinentProvinces + static_cast<int>(states.size()) + 1;
+			states.push_back({province, province + 1, province + width, province + width + 1, island});
+			neighbors[island];
+		}
+	}
+
+	const auto floodStart = std::chrono::steady_clock::now();
+	std::vector<std::set<int>> floodedSets;
+	for (auto remainingProvinces: states)
+	{
+		while (!remainingProvinces.empty())
+		{
+			std::set<int> connectedProvinceSet;
+			std::queue<int> openProvinces;
+			openProvinces.push(*remainingProvinces.begin());
+			std::set<int> closedProvinces{*remainingProvinces.begin()};
+			while (!openProvinces.empty() && !remainingProvinces.empty())
+			{
+				const auto currentProvince = openProvinces.front();
+				openProvinces.pop();
+				if (remainingProvinces.erase(currentProvince) > 0)
+				{
+					connectedProvinceSet.insert(currentProvince);
+				}
+				for (const auto neighbor: neighbors.at(currentProvince))
+				{
+					if (closedProvinces.insert(neighbor).second)
+					{
+						openProvinces.push(neighbor);
+					}
+				}
+			}
+			floodedSets.push_back(connectedProvinceSet);
+		}
+	}
+	const auto floodEnd = std::chrono::steady_clock::now();
+
+	const auto disjointSetsStart = std::chrono::steady_clock::now();
+	std::vector<std::set<int>> disjointSets;
+	for (const auto& state: states)
+	{
+		HoI4::DisjointProvinceSets sets(state);
+		for (const auto province: state)
+		{
+			for (const auto neighbor: neighbors.at(province))
+			{
+				sets.join(province, neighbor);
+			}
+		}
+		for (auto& connectedProvinceSet: sets.getSets())
+		{
+			disjointSets.push_back(std::move(connectedProvinceSet));
+		}
+	}
+	const auto disjointSetsEnd = std::chrono::steady_clock::now();
+
+	ASSERT_EQ(floodedSets, disjointSets);
+	std::cout << "flooding search: "
+				 << std::chrono::duration_cast<std::chrono::milliseconds>(floodEnd - floodStart).count() << " ms\n";
+	std::cout << "disjoint sets: "
+				 << std::chrono::duration_cast<std::chrono::milliseconds>(disjointSetsEnd - disjointSetsStart).count()
+				 << " ms\n";
+}
\ No newline at end of file
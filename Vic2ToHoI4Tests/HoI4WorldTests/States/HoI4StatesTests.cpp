@@ -0,0 +1,79 @@
+#include "HOI4World/Map/Hoi4Province.h"
+#include "HOI4World/Map/MapData.h"
+#include "HOI4World/ProvinceDefinitions.h"
+#include "HOI4World/States/HoI4States.h"
+#include "gtest/gtest.h"
+#include <map>
+#include <set>
+#include <vector>
+
+
+
+// On the test map, provinces 2 and 7 do not border each other, but both border province 1
+std::map<int, HoI4::Province> getTestMapProvinces()
+{
+	std::map<int, HoI4::Province> provinces;
+	for (auto province = 1; province <= 11; province++)
+	{
+		provinces.emplace(province, HoI4::Province(province != 4 && province != 9, "plains"));
+	}
+	return provinces;
+}
+
+
+TEST(HoI4World_States_StatesTests, BorderingProvincesAreConnected)
+{
+	const auto configuration =
+		 Configuration::Builder().setHoI4Path("./MapData").setNumberOfThreads(1).setCacheMapData(false).build();
+	const auto provinceDefinitions = HoI4::ProvinceDefinitions::Importer().importProvinceDefinitions(*configuration);
+	const HoI4::MapData mapData(provinceDefinitions, *configuration);
+
+	const auto connectedProvinceSets =
+		 HoI4::States::getConnectedProvinceSets({2, 5}, mapData, getTestMapProvinces());
+
+	ASSERT_EQ(std::vector<std::set<int>>({{2, 5}}), connectedProvinceSets);
+}
+
+
+TEST(HoI4World_States_StatesTests, ProvincesTouchingOnlyThroughForeignProvinceAreNotConnected)
+{
+	const auto configuration =
+		 Configuration::Builder().setHoI4Path("./MapData").setNumberOfThreads(1).setCacheMapData(false).build();
+	const auto provinceDefinitions = HoI4::ProvinceDefinitions::Importer().importProvinceDefinitions(*configuration);
+	const HoI4::MapData mapData(provinceDefinitions, *configuration);
+
+	const auto connectedProvinceSets =
+		 HoI4::States::getConnectedProvinceSets({2, 7}, mapData, getTestMapProvinces());
+
+	ASSERT_EQ(std::vector<std::set<int>>({{2}, {7}}), connectedProvinceSets);
+}
+
+
+TEST(HoI4World_States_StatesTests, UnconnectedProvincesInSameStrategicRegionAreConsolidated)
+{
+	const auto configuration =
+		 Configuration::Builder().setHoI4Path("./MapData").setNumberOfThreads(1).setCacheMapData(false).build();
+	const auto provinceDefinitions = HoI4::ProvinceDefinitions::Importer().importProvinceDefinitions(*configuration);
+	const HoI4::MapData mapData(provinceDefinitions, *configuration);
+
+	const auto provinceSets = HoI4::States::consolidateProvinceSets(
+		 HoI4::States::getConnectedProvinceSets({2, 7}, mapData, getTestMapProvinces()),
+		 {{2, 42}, {7, 42}});
+
+	ASSERT_EQ(std::vector<std::set<int>>({{2, 7}}), provinceSets);
+}
+
+
+TEST(HoI4World_States_StatesTests, UnconnectedProvincesInDifferentStrategicRegionsAreNotConsolidated)
+{
+	const auto configuration =
+		 Configuration::Builder().setHoI4Path("./MapData").setNumberOfThreads(1).setCacheMapData(false).build();
+	const auto provinceDefinitions = HoI4::ProvinceDefinitions::Importer().importProvinceDefinitions(*configuration);
+	const HoI4::MapData mapData(provinceDefinitions, *configuration);
+
+	const auto provinceSets = HoI4::States::consolidateProvinceSets(
+		 HoI4::States::getConnectedProvinceSets({2, 7}, mapData, getTestMapProvinces()),
+		 {{2, 42}, {7, 43}});
+
+	ASSERT_EQ(std::vector<std::set<int>>({{2}, {7}}), provinceSets);
+}
\ No newline at end of file
@@ -0,0 +1,181 @@
+#include "HOI4World/WarCreator/ProvincePositionGrid.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <random>
+
+
+
+TEST(HoI4World_WarCreator_ProvincePositionGrid, DistanceIsStraightLineWhenNotCrossingEdge)
+{
+	ASSERT_FLOAT_EQ(25.0F, HoI4::getWrappedDistanceSquared({100, 100}, {103, 104}, 5250));
+}
+
+
+TEST(HoI4World_WarCreator_ProvincePositionGrid, DistanceWrapsAroundEdge)
+{
+	ASSERT_FLOAT_EQ(325.0F, HoI4::getWrappedDistanceSquared({5, 100}, {5240, 110}, 5250));
+}
+
+
+TEST(HoI4World_WarCreator_ProvincePositionGrid, EmptyGridReturnsLimit)
+{
+	const HoI4::ProvincePositionGrid grid({}, 5250);
+
+	ASSERT_FLOAT_EQ(42.0F, grid.getNearestDistanceSquared({100, 100}, 42.0F));
+}
+
+
+TEST(HoI4World_WarCreator_ProvincePositionGrid, NearestPositionIsFound)
+{
+	const HoI4::ProvincePositionGrid grid({{100, 100}, {400, 400}, {1000, 1000}}, 5250);
+
+	ASSERT_FLOAT_EQ(200.0F, grid.getNearestDistanceSquared({410, 390}, std::numeric_limits<float>::max()));
+}
+
+
+TEST(HoI4World_WarCreator_ProvincePositionGrid, NearestPositionIsFoundAcrossEdge)
+{
+	const HoI4::ProvincePositionGrid grid({{5200, 500}, {2600, 500}}, 5250);
+
+	ASSERT_FLOAT_EQ(10000.0F, grid.getNearestDistanceSquared({50, 500}, std::numeric_limits<float>::max()));
+}
+
+
+TEST(HoI4World_WarCreator_ProvincePositionGrid, NearestPositionIsFoundFromOutsideGrid)
+{
+	const HoI4::ProvincePositionGrid grid({{300, 1500}, {320, 1510}}, 5250);
+
+	ASSERT_FLOAT_EQ(1960000.0F, grid.getNearestDistanceSquared({300, 100}, std::numeric_limits<float>::max()));
+}
+
+
+TEST(HoI4World_WarCreator_ProvincePositionGrid, LimitIsKeptWhenNothingIsCloser)
+{
+	const HoI4::ProvincePositionGrid grid({{100, 100}}, 5250);
+
+	ASSERT_FLOAT_EQ(50.0F, grid.getNearestDistanceSquared({1000, 1000}, 50.0F));
+}
+
+
+TEST(HoI4World_WarCreator_ProvincePositionGrid, NearestDistanceMatchesExhaustiveSearch)
+{
+	std::mt19937 generator(1234);
+	std::uniform_int_distribution xDistribution(0, 5631);
+	std::uniform_int_distribution yDistribution(0, 2047);
+
+	for (auto trial = 0; trial < 20; trial++)
+	{
+		std::vector<HoI4::Coordinate> positions;
+		const auto numPositions = std::uniform_int_distribution(1, 300)(generator);
+		const auto centerX = xDistribution(generator);
+		const auto centerY = yDistribution(generator);
+		std::uniform_int_distribution offset(-400, 400);
+		for (auto i = 0; i < numPositions; i++)
+		{
+			positions.push_back(
+				 {(centerX + offset(generator) + 5632) % 5632, std::clamp(centerY + offset(generator), 0, 2047)});
+		}
+		const HoI4::ProvincePositionGrid grid(positions, 5250);
+
+		for (auto query = 0; query < 50; query++)
+		{
+			const HoI4::Coordinate position{xDistribution(generator), yDistribution(generator)};
+			auto expected = std::numeric_limits<float>::max();
+			for (const auto& other: positions)
+			{
+				expected = std::min(expected, HoI4::getWrappedDistanceSquared(position, other, 5250));
+			}
+
+			ASSERT_EQ(expected, grid.getNearestDistanceSquared(position, std::numeric_limits<float>::max()));
+		}
+	}
+}
+
+
+// Run with --gtest_also_run_disabled_tests to compare the grid against the pairwise search it replaced
+TEST(HoI4World_WarCreator_ProvincePositionGrid, DISABLED_BenchmarkAgainstPairwiseSearch)
+{
+	constexpr auto numCountries = 150;
+	constexpr auto numProvinces = 13000;
+
+	// countries are clumps of provinces around random centers, like on the real map
+	std::mt19937 generator(1234);
+	std::uniform_int_distribution xDistribution(0, 5631);
+	std::uniform_int_distribution yDistribution(0, 2047);
+	std::vector<HoI4::Coordinate> centers;
+	for (auto country = 0; country < numCountries; country++)
+	{
+		centers.push_back({xDistribution(generator), yDistribution(generator)});
+	}
+	std::map<int, HoI4::Coordinate> provincePositions;
+	std::vector<std::vector<int>> countryProvinces(numCountries);
+	for (auto province = 1; province <= numProvinces; province++)
+	{
+		const HoI4::Coordinate position{xDistribution(generator), yDistribution(generator)};
+		provincePositions.emplace(province, position);
+		const auto owner = std::min_element(centers.begin(), centers.end(), [&position](const auto& a, const auto& b) {
+			return HoI4::getWrappedDistanceSquared(position, a, 5250) < HoI4::getWrappedDistanceSquared(position, b, 5250);
+		});
+		countryProvinces[owner - centers.begin()].push_back(province);
+	}
+
+	const auto pairwiseStart = std::chrono::steady_clock::now();
+	std::vector<float> pairwiseDistances;
+	for (auto country1 = 0; country1 < numCountries; country1++)
+	{
+		for (auto country2 = country1 + 1; country2 < numCountries; country2++)
+		{
+			auto distance = std::numeric_limits<float>::max();
+			for (const auto province1: countryProvinces[country1])
+			{
+				for (const auto province2: countryProvinces[country2])
+				{
+					const auto& position1 = provincePositions.at(province1);
+					const auto& position2 = provincePositions.at(province2);
+					distance = std::min(distance, HoI4::getWrappedDistanceSquared(position1, position2, 5250));
+				}
+			}
+			pairwiseDistances.push_back(distance);
+		}
+	}
+	const auto pairwiseEnd = std::chrono::steady_clock::now();
+
+	const auto gridStart = std::chrono::steady_clock::now();
+	std::vector<HoI4::ProvincePositionGrid> grids;
+	for (const auto& provinces: countryProvinces)
+	{
+		std::vector<HoI4::Coordinate> positions;
+		for (const auto province: provinces)
+		{
+			positions.push_back(provincePositions.at(province));
+		}
+		grids.emplace_back(positions, 5250);
+	}
+	std::vector<float> gridDistances;
+	for (auto country1 = 0; country1 < numCountries; country1++)
+	{
+		for (auto country2 = country1 + 1; country2 < numCountries; country2++)
+		{
+			const auto country1IsSmaller = grids[country1].size() <= grids[country2].size();
+			const auto& searchFrom = country1IsSmaller ? grids[country1] : grids[country2];
+			const auto& searchIn = country1IsSmaller ? grids[country2] : grids[country1];
+			auto distance = std::numeric_limits<float>::max();
+			for (size_t i = 0; i < searchFrom.size(); i++)
+			{
+				distance = searchIn.getNearestDistanceSquared(searchFrom.getPosition(i), distance);
+			}
+			gridDistances.push_back(distance);
+		}
+	}
+	const auto gridEnd = std::chrono::steady_clock::now();
+
+	ASSERT_EQ(pairwiseDistances, gridDistances);
+	std::cout << "pairwise search: "
+				 << std::chrono::duration_cast<std::chrono::milliseconds>(pairwiseEnd - pairwiseStart).count() << " ms\n";
+	std::cout << "grid search: " << std::chrono::duration_cast<std::chrono::milliseconds>(gridEnd - gridStart).count()
+				 << " ms\n";
+}
\ No newline at end of file
@@ -24,6 +24,29 @@ TEST(Mappers_Country_CountryMapperTests, MatchedVic2TagReturnsHoI4Tag)
 }
 
 
+TEST(Mappers_Country_CountryMapperTests, MatchedVic2TagReturnsHoI4TagByTag)
+{
+	const auto mapper = Mappers::CountryMapper::Builder()
+									.addMapping("VIC", "HOI")
+									.addMapping("AAA", "BBB")
+									.addMapping("ZZZ", "YYY")
+									.Build();
+
+	ASSERT_EQ(Tag::parse("HOI"), mapper->getHoI4Tag(*Tag::parse("VIC")));
+	ASSERT_EQ(Tag::parse("BBB"), mapper->getHoI4Tag(*Tag::parse("AAA")));
+	ASSERT_EQ(Tag::parse("YYY"), mapper->getHoI4Tag(*Tag::parse("ZZZ")));
+	ASSERT_EQ(std::nullopt, mapper->getHoI4Tag(*Tag::parse("NON")));
+}
+
+
+TEST(Mappers_Country_CountryMapperTests, LaterMappingReplacesEarlierOne)
+{
+	const auto mapper = Mappers::CountryMapper::Builder().addMapping("VIC", "HOI").addMapping("VIC", "NEW").Build();
+
+	ASSERT_EQ("NEW", mapper->getHoI4Tag("VIC"));
+}
+
+
 TEST(Mappers_Country_CountryMapperTests, MappingCanBeGivenFromRule)
 {
 	const auto mapper = Mappers::CountryMapper::Factory().importCountryMapper(
@@ -0,0 +1,106 @@
+#include "OSCompatibilityLayer.h"
+#include "OutHoi4/FlagCache.h"
+#include "gtest/gtest.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+
+
+namespace
+{
+
+void writeTestFile(const std::string& path, const std::string& contents)
+{
+	std::ofstream file(path, std::ios::binary);
+	file << contents;
+}
+
+
+std::string readTestFile(const std::string& path)
+{
+	const std::ifstream file(path, std::ios::binary);
+	std::stringstream contents;
+	contents << file.rdbuf();
+	return contents.str();
+}
+
+} // namespace
+
+
+
+TEST(OutHoi4_FlagCache, MissingFilesHaveNoContentKey)
+{
+	ASSERT_FALSE(HoI4::FlagCache::getContentKey("MissingFlag.tga"));
+}
+
+
+TEST(OutHoi4_FlagCache, FilesWithTheSameContentsHaveTheSameKey)
+{
+	writeTestFile("FlagCacheTestOne.tga", "flag");
+	writeTestFile("FlagCacheTestTwo.tga", "flag");
+	const auto keyOne = HoI4::FlagCache::getContentKey("FlagCacheTestOne.tga");
+	const auto keyTwo = HoI4::FlagCache::getContentKey("FlagCacheTestTwo.tga");
+	std::remove("FlagCacheTestOne.tga");
+	std::remove("FlagCacheTestTwo.tga");
+
+	ASSERT_TRUE(keyOne);
+	ASSERT_EQ(keyOne, keyTwo);
+}
+
+
+TEST(OutHoi4_FlagCache, FilesWithDifferentContentsHaveDifferentKeys)
+{
+	writeTestFile("FlagCacheTestOne.tga", "flag");
+	writeTestFile("FlagCacheTestTwo.tga", "flab");
+	const auto keyOne = HoI4::FlagCache::getContentKey("FlagCacheTestOne.tga");
+	const auto keyTwo = HoI4::FlagCache::getContentKey("FlagCacheTestTwo.tga");
+	std::remove("FlagCacheTestOne.tga");
+	std::remove("FlagCacheTestTwo.tga");
+
+	ASSERT_TRUE(keyOne);
+	ASSERT_TRUE(keyTwo);
+	ASSERT_NE(keyOne, keyTwo);
+}
+
+
+TEST(OutHoi4_FlagCache, UncachedFlagsAreNotCopied)
+{
+	const HoI4::FlagCache flagCache("FlagCacheTestFolder", 1);
+	const auto copied = flagCache.copyCachedFlag("key", "FlagCacheTestCopy.tga");
+	commonItems::DeleteFolder("FlagCacheTestFolder");
+
+	ASSERT_FALSE(copied);
+	ASSERT_FALSE(commonItems::DoesFileExist("FlagCacheTestCopy.tga"));
+}
+
+
+TEST(OutHoi4_FlagCache, CachedFlagsAreCopied)
+{
+	writeTestFile("FlagCacheTestFlag.tga", "flag");
+	const HoI4::FlagCache flagCache("FlagCacheTestFolder", 1);
+	flagCache.addFlag("key", "FlagCacheTestFlag.tga");
+	std::remove("FlagCacheTestFlag.tga");
+	const auto copied = flagCache.copyCachedFlag("key", "FlagCacheTestCopy.tga");
+	const auto copiedContents = readTestFile("FlagCacheTestCopy.tga");
+	std::remove("FlagCacheTestCopy.tga");
+	commonItems::DeleteFolder("FlagCacheTestFolder");
+
+	ASSERT_TRUE(copied);
+	ASSERT_EQ("flag", copiedContents);
+}
+
+
+TEST(OutHoi4_FlagCache, FlagsFromOtherVersionsAreNotCopied)
+{
+	writeTestFile("FlagCacheTestFlag.tga", "flag");
+	HoI4::FlagCache("FlagCacheTestFolder", 1).addFlag("key", "FlagCacheTestFlag.tga");
+	std::remove("FlagCacheTestFlag.tga");
+	const HoI4::FlagCache flagCache("FlagCacheTestFolder", 2);
+	const auto copied = flagCache.copyCachedFlag("key", "FlagCacheTestCopy.tga");
+	const auto remainingFiles = commonItems::GetAllFilesInFolder("FlagCacheTestFolder");
+	commonItems::DeleteFolder("FlagCacheTestFolder");
+
+	ASSERT_FALSE(copied);
+	ASSERT_TRUE(remainingFiles.empty());
+}
\ No newline at end of file
@@ -0,0 +1,166 @@
+#include "OutHoi4/FlagResizer.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <iostream>
+
+
+
+TEST(OutHoi4_FlagResizer, SizeIsAsGiven)
+{
+	const HoI4::FlagResizer resizer(10, 7, HoI4::FlagResizer::Filter::Box);
+
+	ASSERT_EQ(10, resizer.getWidth());
+	ASSERT_EQ(7, resizer.getHeight());
+	ASSERT_EQ(10 * 7 * 4, resizer.getPixels().size());
+}
+
+
+TEST(OutHoi4_FlagResizer, NearestNeighborPicksOneSourcePixel)
+{
+	// four pixels in a row, each with its own color
+	const std::vector<uint8_t> source{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+	HoI4::FlagResizer resizer(2, 1, HoI4::FlagResizer::Filter::NearestNeighbor);
+	resizer.resize(source.data(), 4, 1, 3);
+
+	const std::vector<uint8_t> expectedPixels{1, 2, 3, 0xFF, 7, 8, 9, 0xFF};
+	ASSERT_EQ(expectedPixels, resizer.getPixels());
+}
+
+
+TEST(OutHoi4_FlagResizer, BoxAveragesCoveredSourcePixels)
+{
+	// two rows of four pixels
+	const std::vector<uint8_t> source{
+		 0, 10, 100, 2, 20, 100, 50, 0, 0, 50, 0, 0, 4, 30, 100, 6, 40, 101, 50, 0, 0, 50, 0, 255};
+	HoI4::FlagResizer resizer(2, 1, HoI4::FlagResizer::Filter::Box);
+	resizer.resize(source.data(), 4, 2, 3);
+
+	const std::vector<uint8_t> expectedPixels{3, 25, 100, 0xFF, 50, 0, 64, 0xFF};
+	ASSERT_EQ(expectedPixels, resizer.getPixels());
+}
+
+
+TEST(OutHoi4_FlagResizer, BoxRepeatsPixelsWhenEnlarging)
+{
+	const std::vector<uint8_t> source{1, 2, 3, 4, 5, 6};
+	HoI4::FlagResizer resizer(4, 1, HoI4::FlagResizer::Filter::Box);
+	resizer.resize(source.data(), 2, 1, 3);
+
+	const std::vector<uint8_t> expectedPixels{1, 2, 3, 0xFF, 1, 2, 3, 0xFF, 4, 5, 6, 0xFF, 4, 5, 6, 0xFF};
+	ASSERT_EQ(expectedPixels, resizer.getPixels());
+}
+
+
+TEST(OutHoi4_FlagResizer, SourceAlphaIsIgnored)
+{
+	const std::vector<uint8_t> source{1, 2, 3, 0, 5, 6, 7, 0};
+	HoI4::FlagResizer nearestResizer(1, 1, HoI4::FlagResizer::Filter::NearestNeighbor);
+	nearestResizer.resize(source.data(), 2, 1, 4);
+	HoI4::FlagResizer boxResizer(1, 1, HoI4::FlagResizer::Filter::Box);
+	boxResizer.resize(source.data(), 2, 1, 4);
+
+	const std::vector<uint8_t> expectedNearestPixels{1, 2, 3, 0xFF};
+	ASSERT_EQ(expectedNearestPixels, nearestResizer.getPixels());
+	const std::vector<uint8_t> expectedBoxPixels{3, 4, 5, 0xFF};
+	ASSERT_EQ(expectedBoxPixels, boxResizer.getPixels());
+}
+
+
+TEST(OutHoi4_FlagResizer, DifferentSourceSizesCanBeResized)
+{
+	HoI4::FlagResizer resizer(1, 1, HoI4::FlagResizer::Filter::Box);
+
+	const std::vector<uint8_t> firstSource{10, 20, 30, 30, 40, 50};
+	resizer.resize(firstSource.data(), 2, 1, 3);
+	const std::vector<uint8_t> expectedFirstPixels{20, 30, 40, 0xFF};
+	ASSERT_EQ(expectedFirstPixels, resizer.getPixels());
+
+	const std::vector<uint8_t> secondSource{10, 20, 30, 20, 30, 40, 30, 40, 50};
+	resizer.resize(secondSource.data(), 1, 3, 3);
+	const std::vector<uint8_t> expectedSecondPixels{20, 30, 40, 0xFF};
+	ASSERT_EQ(expectedSecondPixels, resizer.getPixels());
+}
+
+
+// Run with --gtest_also_run_disabled_tests to compare against the per-pixel loop flags used to be made with
+TEST(OutHoi4_FlagResizer, DISABLED_BenchmarkFlagSizes)
+{
+	// Vic2 flags are 93x64 with three bytes per pixel
+	constexpr unsigned int sourceWidth = 93;
+	constexpr unsigned int sourceHeight = 64;
+	constexpr unsigned int sourceBytesPerPixel = 3;
+	constexpr auto numFlags = 5000;
+	std::vector<uint8_t> source(sourceWidth * sourceHeight * sourceBytesPerPixel);
+	for (size_t i = 0; i < source.size(); i++)
+	{
+		source[i] = static_cast<uint8_t>(i * 31);
+	}
+	const std::vector<std::pair<unsigned int, unsigned int>> sizes{{82, 52}, {41, 26}, {10, 7}};
+
+	const auto perPixelStart = std::chrono::steady_clock::now();
+	std::vector<std::vector<uint8_t>> perPixelFlags;
+	for (auto flag = 0; flag < numFlags; flag++)
+	{
+		perPixelFlags.clear();
+		for (const auto& [sizeX, sizeY]: sizes)
+		{
+			auto& destFlag = perPixelFlags.emplace_back(sizeX * sizeY * 4);
+			for (unsigned int y = 0; y < sizeY; y++)
+			{
+				for (unsigned int x = 0; x < sizeX; x++)
+				{
+					const auto sourceY = static_cast<int>(1.0 * y / sizeY * sourceHeight);
+					const auto sourceX = static_cast<int>(1.0 * x / sizeX * sourceWidth);
+					const auto sourceIndex = (sourceY * sourceWidth + sourceX) * sourceBytesPerPixel;
+					const auto destIndex = (y * sizeX + x) * 4;
+					destFlag[destIndex + 0] = source[sourceIndex + 0];
+					destFlag[destIndex + 1] = source[sourceIndex + 1];
+					destFlag[destIndex + 2] = source[sourceIndex + 2];
+					destFlag[destIndex + 3] = 0xFF;
+				}
+			}
+		}
+	}
+	const auto perPixelEnd = std::chrono::steady_clock::now();
+
+	std::vector<HoI4::FlagResizer> nearestResizers;
+	for (const auto& [sizeX, sizeY]: sizes)
+	{
+		nearestResizers.emplace_back(sizeX, sizeY, HoI4::FlagResizer::Filter::NearestNeighbor);
+	}
+	const auto nearestStart = std::chrono::steady_clock::now();
+	for (auto flag = 0; flag < numFlags; flag++)
+	{
+		for (auto& resizer: nearestResizers)
+		{
+			resizer.resize(source.data(), sourceWidth, sourceHeight, sourceBytesPerPixel);
+		}
+	}
+	const auto nearestEnd = std::chrono::steady_clock::now();
+
+	// flags are written with the smallest size averaged
+	std::vector<HoI4::FlagResizer> flagResizers;
+	flagResizers.emplace_back(82, 52, HoI4::FlagResizer::Filter::NearestNeighbor);
+	flagResizers.emplace_back(41, 26, HoI4::FlagResizer::Filter::NearestNeighbor);
+	flagResizers.emplace_back(10, 7, HoI4::FlagResizer::Filter::Box);
+	const auto flagStart = std::chrono::steady_clock::now();
+	for (auto flag = 0; flag < numFlags; flag++)
+	{
+		for (auto& resizer: flagResizers)
+		{
+			resizer.resize(source.data(), sourceWidth, sourceHeight, sourceBytesPerPixel);
+		}
+	}
+	const auto flagEnd = std::chrono::steady_clock::now();
+
+	for (size_t size = 0; size < sizes.size(); size++)
+	{
+		ASSERT_EQ(perPixelFlags[size], nearestResizers[size].getPixels());
+	}
+	std::cout << "per-pixel loop: "
+				 << std::chrono::duration_cast<std::chrono::milliseconds>(perPixelEnd - perPixelStart).count() << " ms\n";
+	std::cout << "nearest neighbor resizers: "
+				 << std::chrono::duration_cast<std::chrono::milliseconds>(nearestEnd - nearestStart).count() << " ms\n";
+	std::cout << "resizers with the small flag averaged: "
+				 << std::chrono::duration_cast<std::chrono::milliseconds>(flagEnd - flagStart).count() << " ms\n";
+}
\ No newline at end of file
@@ -0,0 +1,156 @@
+#include "OutHoi4/OutputFile.h"
+#include "gtest/gtest.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+
+
+namespace
+{
+
+std::string readTestFile(const std::string& path)
+{
+	const std::ifstream file(path);
+	std::stringstream contents;
+	contents << file.rdbuf();
+	return contents.str();
+}
+
+} // namespace
+
+
+
+TEST(OutHoi4_OutputFile, UnopenedFileIsNotOpen)
+{
+	const HoI4::OutputFile file;
+
+	ASSERT_FALSE(file.is_open());
+}
+
+
+TEST(OutHoi4_OutputFile, FileInMissingFolderIsNotOpen)
+{
+	const HoI4::OutputFile file("MissingFolder/OutputFileTest.txt");
+
+	ASSERT_FALSE(file.is_open());
+	ASSERT_TRUE(file.fail());
+}
+
+
+TEST(OutHoi4_OutputFile, ContentsAreWrittenOnClose)
+{
+	HoI4::OutputFile file("OutputFileTest.txt");
+	file << "line " << 1 << "\n";
+	file.close();
+	const auto contents = readTestFile("OutputFileTest.txt");
+	std::remove("OutputFileTest.txt");
+
+	ASSERT_FALSE(file.is_open());
+	ASSERT_EQ("line 1\n", contents);
+}
+
+
+TEST(OutHoi4_OutputFile, ContentsAreWrittenWhenDestroyed)
+{
+	{
+		HoI4::OutputFile file("OutputFileTest.txt");
+		file << "line\n";
+	}
+	const auto contents = readTestFile("OutputFileTest.txt");
+	std::remove("OutputFileTest.txt");
+
+	ASSERT_EQ("line\n", contents);
+}
+
+
+TEST(OutHoi4_OutputFile, ContentsOverAMegabyteAreAllWritten)
+{
+	std::string expectedContents;
+	for (auto line = 0; line < 100000; line++)
+	{
+		expectedContents += "line " + std::to_string(line) + "\n";
+	}
+	ASSERT_GT(expectedContents.size(), 1 << 20);
+
+	{
+		HoI4::OutputFile file("OutputFileTest.txt");
+		for (auto line = 0; line < 100000; line++)
+		{
+			file << "line " << line << "\n";
+		}
+	}
+	const auto contents = readTestFile("OutputFileTest.txt");
+	std::remove("OutputFileTest.txt");
+
+	ASSERT_EQ(expectedContents, contents);
+}
+
+
+TEST(OutHoi4_OutputFile, AppendModeKeepsExistingContents)
+{
+	{
+		std::ofstream file("OutputFileTest.txt");
+		file << "first\n";
+	}
+	{
+		HoI4::OutputFile file("OutputFileTest.txt", std::ios_base::app);
+		file << "second\n";
+	}
+	const auto contents = readTestFile("OutputFileTest.txt");
+	std::remove("OutputFileTest.txt");
+
+	ASSERT_EQ("first\nsecond\n", contents);
+}
+
+
+TEST(OutHoi4_OutputFile, DefaultModeReplacesExistingContents)
+{
+	{
+		std::ofstream file("OutputFileTest.txt");
+		file << "first\n";
+	}
+	{
+		HoI4::OutputFile file("OutputFileTest.txt");
+		file << "second\n";
+	}
+	const auto contents = readTestFile("OutputFileTest.txt");
+	std::remove("OutputFileTest.txt");
+
+	ASSERT_EQ("second\n", contents);
+}
+
+
+TEST(OutHoi4_OutputFile, ReopenedFileOnlyWritesNewContents)
+{
+	HoI4::OutputFile file("OutputFileTestOne.txt");
+	file << "first\n";
+	file.close();
+	file.open("OutputFileTestTwo.txt");
+	file << "second\n";
+	file.close();
+	const auto firstContents = readTestFile("OutputFileTestOne.txt");
+	const auto secondContents = readTestFile("OutputFileTestTwo.txt");
+	std::remove("OutputFileTestOne.txt");
+	std::remove("OutputFileTestTwo.txt");
+
+	ASSERT_EQ("first\n", firstContents);
+	ASSERT_EQ("second\n", secondContents);
+}
+
+
+TEST(OutHoi4_OutputFile, OpeningAnotherFileWritesTheFirst)
+{
+	HoI4::OutputFile file("OutputFileTestOne.txt");
+	file << "first\n";
+	file.open("OutputFileTestTwo.txt");
+	file << "second\n";
+	file.close();
+	const auto firstContents = readTestFile("OutputFileTestOne.txt");
+	const auto secondContents = readTestFile("OutputFileTestTwo.txt");
+	std::remove("OutputFileTestOne.txt");
+	std::remove("OutputFileTestTwo.txt");
+
+	ASSERT_EQ("first\n", firstContents);
+	ASSERT_EQ("second\n", secondContents);
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#include "ParallelFor.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+
+TEST(ParallelForTests, EveryIndexIsWorkedOnOnce)
+{
+	std::vector<int> timesWorkedOn(1000, 0);
+	forEachInParallel(timesWorkedOn.size(), 4, [&timesWorkedOn](const size_t index) {
+		timesWorkedOn[index]++;
+	});
+
+	ASSERT_EQ(std::vector(1000, 1), timesWorkedOn);
+}
+
+
+TEST(ParallelForTests, NoWorkIsDoneForNoIndexes)
+{
+	auto workDone = false;
+	forEachInParallel(0, 4, [&workDone](size_t) {
+		workDone = true;
+	});
+
+	ASSERT_FALSE(workDone);
+}
+
+
+TEST(ParallelForTests, ZeroThreadsUsesHardwareThreads)
+{
+	std::vector<int> timesWorkedOn(100, 0);
+	forEachInParallel(timesWorkedOn.size(), 0, [&timesWorkedOn](const size_t index) {
+		timesWorkedOn[index]++;
+	});
+
+	ASSERT_EQ(std::vector(100, 1), timesWorkedOn);
+}
+
+
+TEST(ParallelForTests, ExceptionsArePassedOn)
+{
+	const auto failOnOneIndex = [](const size_t index) {
+		if (index == 42)
+		{
+			throw std::runtime_error("bad index");
+		}
+	};
+
+	ASSERT_THROW(forEachInParallel(100, 4, failOnOneIndex), std::runtime_error);
+}
+
+
+TEST(ParallelForTests, ExceptionThatHappenedFirstIsPassedOn)
+{
+	const auto failSlowlyOnIndexZero = [](const size_t index) {
+		if (index == 0)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(200));
+			throw std::runtime_error("slow failure");
+		}
+		throw std::runtime_error("fast failure");
+	};
+
+	try
+	{
+		forEachInParallel(2, 2, failSlowlyOnIndexZero);
+		FAIL();
+	}
+	catch (const std::runtime_error& error)
+	{
+		ASSERT_EQ(std::string("fast failure"), error.what());
+	}
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+#include "TagSet.h"
+#include "gtest/gtest.h"
+#include <vector>
+
+
+
+TEST(TagSetTests, TagSetsDefaultToEmpty)
+{
+	const TagSet tags;
+
+	ASSERT_TRUE(tags.empty());
+	ASSERT_EQ(0, tags.size());
+}
+
+
+TEST(TagSetTests, TagsAreKeptOnceInOrder)
+{
+	TagSet tags;
+	tags.insert(*Tag::parse("ENG"));
+	tags.insert(*Tag::parse("AUS"));
+	tags.insert(*Tag::parse("ENG"));
+	tags.insert(*Tag::parse("FRA"));
+
+	ASSERT_EQ(std::vector({*Tag::parse("AUS"), *Tag::parse("ENG"), *Tag::parse("FRA")}),
+		 std::vector(tags.begin(), tags.end()));
+}
+
+
+TEST(TagSetTests, TagsCanBeErased)
+{
+	TagSet tags{*Tag::parse("AUS"), *Tag::parse("ENG")};
+	tags.erase(*Tag::parse("ENG"));
+	tags.erase(*Tag::parse("FRA"));
+
+	ASSERT_EQ(TagSet{*Tag::parse("AUS")}, tags);
+}
+
+
+TEST(TagSetTests, ContainedTagsCanBeFoundByTagOrString)
+{
+	const TagSet tags{*Tag::parse("AUS"), *Tag::parse("ENG")};
+
+	ASSERT_TRUE(tags.contains(*Tag::parse("ENG")));
+	ASSERT_TRUE(tags.contains("AUS"));
+	ASSERT_FALSE(tags.contains(*Tag::parse("FRA")));
+	ASSERT_FALSE(tags.contains("FRA"));
+	ASSERT_FALSE(tags.contains("ENGLAND"));
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#include "Tag.h"
+#include "gtest/gtest.h"
+#include <sstream>
+#include <unordered_set>
+
+
+
+TEST(TagTests, ThreeCharacterTagsCanBeParsed)
+{
+	const auto tag = Tag::parse("TAG");
+
+	ASSERT_TRUE(tag);
+	ASSERT_EQ("TAG", tag->toString());
+}
+
+
+TEST(TagTests, TagsOfOtherLengthsCannotBeParsed)
+{
+	ASSERT_EQ(std::nullopt, Tag::parse(""));
+	ASSERT_EQ(std::nullopt, Tag::parse("TA"));
+	ASSERT_EQ(std::nullopt, Tag::parse("TAGS"));
+}
+
+
+TEST(TagTests, TagsSortLikeTheirStrings)
+{
+	ASSERT_LT(*Tag::parse("ABC"), *Tag::parse("ABD"));
+	ASSERT_LT(*Tag::parse("A99"), *Tag::parse("AAA"));
+	ASSERT_LT(*Tag::parse("D01"), *Tag::parse("ENG"));
+	ASSERT_EQ(*Tag::parse("ENG"), *Tag::parse("ENG"));
+}
+
+
+TEST(TagTests, TagsCanBeOutput)
+{
+	std::stringstream output;
+	output << *Tag::parse("ENG");
+
+	ASSERT_EQ("ENG", output.str());
+}
+
+
+TEST(TagTests, TagsCanBeHashed)
+{
+	const std::unordered_set<Tag> tags{*Tag::parse("ENG"), *Tag::parse("FRA"), *Tag::parse("ENG")};
+
+	ASSERT_EQ(2, tags.size());
+	ASSERT_TRUE(tags.contains(*Tag::parse("FRA")));
+}
\ No newline at end of file
@@ -2191,7 +2191,7 @@ TEST(Vic2World_Countries_CountryTests, IssueSupportDefaultsToZero)
 										  0.05F,
 										  std::nullopt);
 
-	ASSERT_EQ(0, country->getAverageIssueSupport("test_issue"));
+	ASSERT_EQ(0, country->getAverageIssueSupport(1));
 }
 
 
@@ -2214,10 +2214,10 @@ TEST(Vic2World_Countries_CountryTests, IssueSupportComesFromProvinces)
 	country->addProvince(1,
 		 Vic2::Province::Builder()
 			  .setNumber(1)
-			  .setPops({*Vic2::Pop::Builder().setIssues({std::make_pair("test_issue", 0.5F)}).setSize(5).build()})
+			  .setPops({*Vic2::Pop::Builder().setIssues({std::make_pair(1U, 0.5F)}).setSize(5).build()})
 			  .build());
 
-	ASSERT_EQ(0.5F, country->getAverageIssueSupport("test_issue"));
+	ASSERT_EQ(0.5F, country->getAverageIssueSupport(1));
 }
 
 
@@ -48,4 +48,41 @@ TEST(Vic2World_CultureGroupsTests, OnlyFinalModCulturesCanBeMatched)
 	ASSERT_NE("base_game_group", cultureGroups->getGroup("matched_culture"));
 	ASSERT_NE("mod_one_group", cultureGroups->getGroup("matched_mod_one_culture"));
 	ASSERT_EQ("mod_two_group", cultureGroups->getGroup("matched_mod_two_culture"));
-}
\ No newline at end of file
+}
+
+TEST(Vic2World_CultureGroupsTests, GroupedCulturesHaveIds)
+{
+	const auto cultureGroups =
+		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().setVic2Path("./BaseCultures").build());
+
+	ASSERT_EQ(0, cultureGroups->getCultureId("matched_culture"));
+	ASSERT_EQ(std::nullopt, cultureGroups->getCultureId("unmatched_culture"));
+	ASSERT_EQ(1, cultureGroups->getNumberOfCultures());
+}
+
+
+TEST(Vic2World_CultureGroupsTests, AddedCulturesGetNewIdsButNoGroup)
+{
+	const auto cultureGroups =
+		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().setVic2Path("./BaseCultures").build());
+
+	ASSERT_EQ(1, cultureGroups->addCulture("unmatched_culture"));
+	ASSERT_EQ(0, cultureGroups->addCulture("matched_culture"));
+	ASSERT_EQ(1, cultureGroups->getCultureId("unmatched_culture"));
+	ASSERT_EQ(std::nullopt, cultureGroups->getGroup("unmatched_culture"));
+	ASSERT_EQ("base_game_group", cultureGroups->getGroup("matched_culture"));
+}
+
+
+TEST(Vic2World_CultureGroupsTests, AddedCulturesAreInCultureSet)
+{
+	const auto cultureGroups =
+		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().setVic2Path("./BaseCultures").build());
+
+	const auto cultureSet = cultureGroups->addCultures({"unmatched_culture", "another_culture"});
+
+	ASSERT_FALSE(cultureSet.contains(*cultureGroups->getCultureId("matched_culture")));
+	ASSERT_TRUE(cultureSet.contains(*cultureGroups->getCultureId("unmatched_culture")));
+	ASSERT_TRUE(cultureSet.contains(*cultureGroups->getCultureId("another_culture")));
+	ASSERT_FALSE(cultureSet.contains(42));
+}
@@ -26,4 +26,24 @@ TEST(Vic2World_Issues_IssuesBuilderTests, IssuesCanBeAdded)
 	const auto issues = Vic2::Issues::Builder().addIssueName("issue_1").build();
 
 	ASSERT_EQ("issue_1", issues->getIssueName(1));
+}
+
+
+TEST(Vic2World_Issues_IssuesBuilderTests, IssueNumbersCanBeLookedUp)
+{
+	const auto issues = Vic2::Issues::Builder().setIssueNames({"issue_1", "issue_2"}).build();
+
+	ASSERT_EQ(1, issues->getIssueNumber("issue_1"));
+	ASSERT_EQ(2, issues->getIssueNumber("issue_2"));
+}
+
+
+TEST(Vic2World_Issues_IssuesBuilderTests, MissingIssuesHaveNoNumber)
+{
+	const auto issues = Vic2::Issues::Builder().setIssueNames({"issue_1", "issue_2"}).build();
+
+	ASSERT_EQ(std::nullopt, issues->getIssueNumber("issue_3"));
+	ASSERT_FALSE(issues->isValidIssueNumber(0));
+	ASSERT_TRUE(issues->isValidIssueNumber(2));
+	ASSERT_FALSE(issues->isValidIssueNumber(3));
 }
\ No newline at end of file
@@ -211,4 +211,16 @@ TEST(Vic2World_Localisations_LocalisationsTests, UpdateDomainCountrySkipsMissing
 	auto localisations = Vic2::Localisations::Factory().importLocalisations(*configuration);
 
 	ASSERT_NO_THROW(localisations->updateDomainCountry("NON", "Replacement Region English"));
+}
+
+
+TEST(Vic2World_Localisations_LocalisationsTests, ConstructedLocalisationsOnlyHaveGivenLanguages)
+{
+	const Vic2::Localisations localisations{
+		 {std::make_pair("TAG", Vic2::LanguageToLocalisationMap{{"english", "Test"}, {"spanish", "Prueba"}})},
+		 {}};
+
+	const Vic2::LanguageToLocalisationMap expected{{"english", "Test"}, {"spanish", "Prueba"}};
+	ASSERT_EQ(expected, localisations.getTextInEachLanguage("TAG"));
+	ASSERT_EQ(std::nullopt, localisations.getTextInLanguage("TAG", "french"));
 }
\ No newline at end of file
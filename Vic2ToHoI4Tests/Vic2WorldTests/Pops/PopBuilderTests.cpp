@@ -19,6 +19,30 @@ TEST(Vic2World_Pops_PopBuilderTests, TypeCanBeSet)
 }
 
 
+TEST(Vic2World_Pops_PopBuilderTests, PopTypeDefaultsToOther)
+{
+	const auto pop = Vic2::Pop::Builder().build();
+
+	ASSERT_EQ(Vic2::PopType::other, pop->getPopType());
+}
+
+
+TEST(Vic2World_Pops_PopBuilderTests, PopTypeComesFromType)
+{
+	const auto pop = Vic2::Pop::Builder().setType("craftsmen").build();
+
+	ASSERT_EQ(Vic2::PopType::craftsmen, pop->getPopType());
+}
+
+
+TEST(Vic2World_Pops_PopBuilderTests, UnknownTypesHavePopTypeOther)
+{
+	const auto pop = Vic2::Pop::Builder().setType("test_type").build();
+
+	ASSERT_EQ(Vic2::PopType::other, pop->getPopType());
+}
+
+
 TEST(Vic2World_Pops_PopBuilderTests, CultureDefaultsToNoCulture)
 {
 	const auto pop = Vic2::Pop::Builder().build();
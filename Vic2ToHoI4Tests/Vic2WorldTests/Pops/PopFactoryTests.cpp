@@ -1,7 +1,10 @@
 #include "V2World/Issues/IssuesBuilder.h"
+#include "V2World/ParseWarning.h"
 #include "V2World/Pops/PopFactory.h"
 #include "gtest/gtest.h"
 #include <sstream>
+#include <string>
+#include <vector>
 
 
 
@@ -187,6 +190,32 @@ TEST_F(Vic2World_Pops_PopFactoryTests, IssueWithNonFloatIssueSupportLogsWarning)
 }
 
 
+TEST_F(Vic2World_Pops_PopFactoryTests, IssueWarningsGoToCollectorInsteadOfLog)
+{
+	std::stringstream input;
+	input << "{\n";
+	input << "\tissues = {\n";
+	input << "\t42=not_a_float\n";
+	input << "\t}\n";
+	input << "}";
+
+	const std::stringstream log;
+	const auto stdOutBuf = std::cout.rdbuf();
+	std::cout.rdbuf(log.rdbuf());
+
+	std::vector<std::string> warnings;
+	{
+		const Vic2::ParseWarningCollector warningCollector(warnings);
+		const auto pop = popFactory.getPop("test_type", input);
+	}
+
+	std::cout.rdbuf(stdOutBuf);
+
+	ASSERT_TRUE(log.str().empty());
+	ASSERT_EQ(std::vector<std::string>{"Poorly formatted pop issue: 42=not_a_float"}, warnings);
+}
+
+
 TEST(Vic2World_Pops_PopTests, IssuesCanBeImported)
 {
 	std::stringstream input;
@@ -198,5 +227,52 @@ TEST(Vic2World_Pops_PopTests, IssuesCanBeImported)
 	const auto pop =
 		 Vic2::Pop::Factory(*Vic2::Issues::Builder().addIssueName("learn_the_question").build()).getPop("", input);
 
-	ASSERT_NEAR(87.125, pop->getIssueSupport("learn_the_question"), 0.001);
+	ASSERT_NEAR(87.125, pop->getIssueSupport(1), 0.001);
+}
+
+
+TEST(Vic2World_Pops_PopTests, UnknownIssuesAreSkipped)
+{
+	std::stringstream input;
+	input << "{\n";
+	input << "\tissues={\n";
+	input << "1=87.125\n";
+	input << "2=12.875\n";
+	input << "\t}";
+	input << "}";
+	const auto pop =
+		 Vic2::Pop::Factory(*Vic2::Issues::Builder().addIssueName("learn_the_question").build()).getPop("", input);
+
+	ASSERT_NEAR(87.125, pop->getIssueSupport(1), 0.001);
+	ASSERT_NEAR(0.0, pop->getIssueSupport(2), 0.001);
+}
+
+
+TEST(Vic2World_Pops_PopTests, IssuesCanBeFoundWhateverOrderTheyAreImported)
+{
+	std::stringstream input;
+	input << "{\n";
+	input << "\tissues={\n";
+	input << "2=50.0\n";
+	input << "10=12.875\n";
+	input << "1=87.125\n";
+	input << "\t}";
+	input << "}";
+	const auto issues = Vic2::Issues::Builder()
+								 .setIssueNames({"issue_1",
+									  "issue_2",
+									  "issue_3",
+									  "issue_4",
+									  "issue_5",
+									  "issue_6",
+									  "issue_7",
+									  "issue_8",
+									  "issue_9",
+									  "issue_10"})
+								 .build();
+	const auto pop = Vic2::Pop::Factory(*issues).getPop("", input);
+
+	ASSERT_NEAR(87.125, pop->getIssueSupport(1), 0.001);
+	ASSERT_NEAR(50.0, pop->getIssueSupport(2), 0.001);
+	ASSERT_NEAR(12.875, pop->getIssueSupport(10), 0.001);
 }
\ No newline at end of file
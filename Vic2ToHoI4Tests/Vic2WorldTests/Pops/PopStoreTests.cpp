@@ -0,0 +1,96 @@
+#include "V2World/Culture/CultureGroups.h"
+#include "V2World/Pops/PopBuilder.h"
+#include "V2World/Pops/PopStore.h"
+#include "gtest/gtest.h"
+#include <memory>
+
+
+
+TEST(Vic2World_Pops_PopStoreTests, AddedPopsCanBeReturned)
+{
+	Vic2::PopStore popStore;
+	const auto pop = Vic2::Pop::Builder()
+							  .setType("farmers")
+							  .setCulture("culture")
+							  .setSize(12)
+							  .setLiteracy(0.25)
+							  .setMilitancy(0.5)
+							  .setIssues({{3, 0.75F}, {1, 0.25F}})
+							  .build();
+	const auto rows = popStore.addPops({*pop});
+
+	const auto pops = popStore.getPops(rows);
+	ASSERT_EQ(1, pops.size());
+	ASSERT_EQ("farmers", pops[0].getType());
+	ASSERT_EQ(Vic2::PopType::farmers, pops[0].getPopType());
+	ASSERT_EQ("culture", pops[0].getCulture());
+	ASSERT_EQ(12, pops[0].getSize());
+	ASSERT_NEAR(0.25, pops[0].getLiteracy(), 0.0001);
+	ASSERT_NEAR(0.5, pops[0].getMilitancy(), 0.0001);
+	const std::vector<std::pair<unsigned int, float>> expectedIssues{{1, 0.25F}, {3, 0.75F}};
+	ASSERT_EQ(expectedIssues, pops[0].getIssues());
+}
+
+
+TEST(Vic2World_Pops_PopStoreTests, RowsCoverOnlyTheirOwnPops)
+{
+	Vic2::PopStore popStore;
+	const auto firstRows = popStore.addPops({*Vic2::Pop::Builder().setSize(1).build()});
+	const auto secondRows =
+		 popStore.addPops({*Vic2::Pop::Builder().setSize(2).build(), *Vic2::Pop::Builder().setSize(3).build()});
+
+	ASSERT_EQ(1, popStore.getPops(firstRows).size());
+	ASSERT_EQ(2, popStore.getPops(secondRows).size());
+	ASSERT_EQ(2, popStore.getSize(secondRows.first));
+}
+
+
+TEST(Vic2World_Pops_PopStoreTests, RowsFromAnotherStoreKeepTheirTypesCulturesAndIssues)
+{
+	Vic2::PopStore worldStore;
+	const auto worldRows = worldStore.addPops(
+		 {*Vic2::Pop::Builder().setType("clerks").setCulture("culture").setSize(1).setIssues({{2, 0.5F}}).build()});
+
+	Vic2::PopStore provinceStore;
+	const auto provinceRows = provinceStore.addPops(
+		 {*Vic2::Pop::Builder().setType("farmers").setCulture("culture2").setSize(4).setIssues({{2, 0.25F}}).build(),
+			  *Vic2::Pop::Builder().setType("clerks").setCulture("culture").setSize(2).build()});
+	const auto movedRows = worldStore.addRows(provinceStore, provinceRows);
+
+	const auto pops = worldStore.getPops(movedRows);
+	ASSERT_EQ(2, pops.size());
+	ASSERT_EQ("farmers", pops[0].getType());
+	ASSERT_EQ("culture2", pops[0].getCulture());
+	ASSERT_NEAR(0.25F, pops[0].getIssueSupport(2), 0.0001);
+	ASSERT_EQ("clerks", pops[1].getType());
+	ASSERT_EQ("culture", pops[1].getCulture());
+	ASSERT_TRUE(pops[1].getIssues().empty());
+	ASSERT_NEAR(0.5F, worldStore.getPopulationWeightedIssueSupport(worldRows, 2), 0.0001);
+	ASSERT_NEAR(1.0F, worldStore.getPopulationWeightedIssueSupport(movedRows, 2), 0.0001);
+}
+
+
+TEST(Vic2World_Pops_PopStoreTests, PopulationWithCulturesCountsOnlyThoseCultures)
+{
+	Vic2::PopStore popStore;
+	const auto rows = popStore.addPops({*Vic2::Pop::Builder().setCulture("culture").setSize(1).build(),
+		 *Vic2::Pop::Builder().setCulture("culture2").setSize(2).build(),
+		 *Vic2::Pop::Builder().setCulture("culture3").setSize(4).build()});
+
+	ASSERT_EQ(5, popStore.getPopulationWithCultures(rows, std::set<std::string>{"culture", "culture3"}));
+}
+
+
+TEST(Vic2World_Pops_PopStoreTests, CulturesAddedAfterIndexingAreIndexedNextTime)
+{
+	Vic2::PopStore popStore;
+	Vic2::CultureGroups cultureGroups;
+	const auto firstRows = popStore.addPops({*Vic2::Pop::Builder().setCulture("culture").setSize(1).build()});
+	popStore.indexCultures(cultureGroups);
+	const auto secondRows = popStore.addPops({*Vic2::Pop::Builder().setCulture("culture2").setSize(2).build()});
+
+	ASSERT_EQ(0, popStore.getPopulationWithCultures(secondRows, cultureGroups.addCultures({"culture2"})));
+	popStore.indexCultures(cultureGroups);
+	ASSERT_EQ(2, popStore.getPopulationWithCultures(secondRows, cultureGroups.addCultures({"culture2"})));
+	ASSERT_EQ(1, popStore.getPopulationWithCultures(firstRows, cultureGroups.addCultures({"culture"})));
+}
\ No newline at end of file
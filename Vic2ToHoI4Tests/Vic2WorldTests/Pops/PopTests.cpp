@@ -8,13 +8,24 @@ TEST(Vic2World_Pops_PopTests, SupportForMissingIssueIsZero)
 {
 	const auto pop = Vic2::Pop::Builder().build();
 
-	ASSERT_NEAR(0.0, pop->getIssueSupport("missing_issue"), 0.001);
+	ASSERT_NEAR(0.0, pop->getIssueSupport(1), 0.001);
 }
 
 
 TEST(Vic2World_Pops_PopTests, SupportForIssuesCanBeReturned)
 {
-	const auto pop = Vic2::Pop::Builder().setIssues({{"learn_the_question", 87.125f}}).build();
+	const auto pop = Vic2::Pop::Builder().setIssues({{1, 87.125f}}).build();
 
-	ASSERT_NEAR(87.125, pop->getIssueSupport("learn_the_question"), 0.001);
+	ASSERT_NEAR(87.125, pop->getIssueSupport(1), 0.001);
+}
+
+
+TEST(Vic2World_Pops_PopTests, SupportForIssuesCanBeReturnedWhenSetOutOfOrder)
+{
+	const auto pop = Vic2::Pop::Builder().setIssues({{7, 12.5f}, {2, 37.5f}, {4, 50.0f}}).build();
+
+	ASSERT_NEAR(37.5, pop->getIssueSupport(2), 0.001);
+	ASSERT_NEAR(50.0, pop->getIssueSupport(4), 0.001);
+	ASSERT_NEAR(12.5, pop->getIssueSupport(7), 0.001);
+	ASSERT_NEAR(0.0, pop->getIssueSupport(3), 0.001);
 }
\ No newline at end of file
@@ -3,7 +3,9 @@
 #include "V2World/Provinces/Province.h"
 #include "V2World/Provinces/ProvinceBuilder.h"
 #include "gtest/gtest.h"
+#include <memory>
 #include <sstream>
+#include <vector>
 
 
 
@@ -55,7 +57,21 @@ TEST(Vic2World_ProvinceTests, getPopulationDiscriminatesBySpecifiedPopType)
 												*Vic2::Pop::Builder().setType("slaves").setSize(2).build()})
 										  .build();
 
-	ASSERT_EQ(theProvince->getPopulation("slaves"), 2);
+	ASSERT_EQ(theProvince->getPopulation(Vic2::PopType::slaves), 2);
+}
+
+
+TEST(Vic2World_ProvinceTests, getPopulationCountsPopsOfUnknownTypesOnlyInTotal)
+{
+	const auto theProvince = Vic2::Province::Builder()
+										  .setNumber(42)
+										  .setPops({*Vic2::Pop::Builder().setType("test_type").setSize(1).build(),
+												*Vic2::Pop::Builder().setType("slaves").setSize(2).build()})
+										  .build();
+
+	ASSERT_EQ(theProvince->getPopulation(), 3);
+	ASSERT_EQ(theProvince->getPopulation(Vic2::PopType::slaves), 2);
+	ASSERT_EQ(theProvince->getPopulation(Vic2::PopType::serfs), 0);
 }
 
 
@@ -74,7 +90,7 @@ TEST(Vic2World_ProvinceTests, getLiteracyWeightedPopulationGivesTenPercentAtNoLi
 										  .setPops({*Vic2::Pop::Builder().setType("aristocrats").setSize(100).build()})
 										  .build();
 
-	ASSERT_EQ(theProvince->getLiteracyWeightedPopulation("aristocrats"), 10);
+	ASSERT_EQ(theProvince->getLiteracyWeightedPopulation(Vic2::PopType::aristocrats), 10);
 }
 
 
@@ -86,7 +102,7 @@ TEST(Vic2World_ProvinceTests, getLiteracyWeightedPopulationGivesOneHundredPercen
 			  .setPops({*Vic2::Pop::Builder().setType("aristocrats").setSize(100).setLiteracy(1.0).build()})
 			  .build();
 
-	ASSERT_EQ(theProvince->getLiteracyWeightedPopulation("aristocrats"), 100);
+	ASSERT_EQ(theProvince->getLiteracyWeightedPopulation(Vic2::PopType::aristocrats), 100);
 }
 
 
@@ -99,7 +115,7 @@ TEST(Vic2World_ProvinceTests, getLiteracyWeightedPopulationDiscriminatesByPopTyp
 					*Vic2::Pop::Builder().setType("artisans").setSize(100).setLiteracy(0.5).build()})
 			  .build();
 
-	ASSERT_EQ(theProvince->getLiteracyWeightedPopulation("aristocrats"), 100);
+	ASSERT_EQ(theProvince->getLiteracyWeightedPopulation(Vic2::PopType::aristocrats), 100);
 }
 
 
@@ -192,6 +208,80 @@ TEST(Vic2World_ProvinceTests, ownerCanBeChanged)
 }
 
 
+TEST(Vic2World_ProvinceTests, getPercentageWithCultureSetCountsIndexedCultures)
+{
+	const auto theProvince = Vic2::Province::Builder()
+										  .setNumber(42)
+										  .setPops({*Vic2::Pop::Builder().setCulture("culture").setSize(1).build(),
+												*Vic2::Pop::Builder().setCulture("culture2").setSize(3).build()})
+										  .build();
+	Vic2::CultureGroups cultureGroups;
+	theProvince->indexCultures(cultureGroups);
+
+	ASSERT_NEAR(theProvince->getPercentageWithCultures(cultureGroups.addCultures({"culture2", "culture3"})),
+		 0.75,
+		 0.0001);
+}
+
+
+TEST(Vic2World_ProvinceTests, populationByCultureAddsUpPopsOfEachCulture)
+{
+	const auto theProvince = Vic2::Province::Builder()
+										  .setNumber(42)
+										  .setPops({*Vic2::Pop::Builder().setCulture("culture").setSize(1).build(),
+												*Vic2::Pop::Builder().setCulture("culture2").setSize(2).build(),
+												*Vic2::Pop::Builder().setCulture("culture").setSize(4).build()})
+										  .build();
+
+	const std::map<std::string, int> expectedPopulations{{"culture", 5}, {"culture2", 2}};
+	ASSERT_EQ(theProvince->getPopulationByCulture(), expectedPopulations);
+}
+
+
+TEST(Vic2World_ProvinceTests, populationWeightedIssueSupportIsZeroForMissingIssue)
+{
+	const auto theProvince = Vic2::Province::Builder()
+										  .setNumber(42)
+										  .setPops({*Vic2::Pop::Builder().setIssues({{1, 0.5F}}).setSize(4).build()})
+										  .build();
+
+	ASSERT_NEAR(theProvince->getPopulationWeightedIssueSupport(2), 0.0F, 0.0001);
+}
+
+
+TEST(Vic2World_ProvinceTests, populationWeightedIssueSupportAddsUpSupportTimesSize)
+{
+	const auto theProvince =
+		 Vic2::Province::Builder()
+			  .setNumber(42)
+			  .setPops({*Vic2::Pop::Builder().setIssues({{1, 0.5F}, {2, 0.25F}}).setSize(4).build(),
+					*Vic2::Pop::Builder().setIssues({{1, 0.75F}}).setSize(2).build()})
+			  .build();
+
+	ASSERT_NEAR(theProvince->getPopulationWeightedIssueSupport(1), 3.5F, 0.0001);
+	ASSERT_NEAR(theProvince->getPopulationWeightedIssueSupport(2), 1.0F, 0.0001);
+}
+
+
+TEST(Vic2World_ProvinceTests, popsMovedToAnotherStoreGiveTheSameTotals)
+{
+	const std::vector pops{*Vic2::Pop::Builder().setType("farmers").setCulture("culture").setSize(4).build(),
+		 *Vic2::Pop::Builder().setType("clerks").setCulture("culture2").setIssues({{1, 0.5F}}).setSize(2).build()};
+	const auto theProvince = Vic2::Province::Builder().setNumber(42).setPops(pops).build();
+	const auto worldPopStore = std::make_shared<Vic2::PopStore>();
+	worldPopStore->addPops({*Vic2::Pop::Builder().setType("artisans").setCulture("culture3").setSize(8).build()});
+
+	theProvince->movePopsTo(worldPopStore);
+
+	ASSERT_EQ(6, theProvince->getTotalPopulation());
+	ASSERT_EQ(4, theProvince->getPopulation(Vic2::PopType::farmers));
+	ASSERT_EQ(2, theProvince->getPops().size());
+	const std::map<std::string, int> expectedPopulations{{"culture", 4}, {"culture2", 2}};
+	ASSERT_EQ(expectedPopulations, theProvince->getPopulationByCulture());
+	ASSERT_NEAR(1.0F, theProvince->getPopulationWeightedIssueSupport(1), 0.0001);
+}
+
+
 TEST(Vic2World_ProvinceTests, coresCanBeAdded)
 {
 	const auto theProvince = Vic2::Province::Builder().setNumber(42).build();
@@ -21,6 +21,34 @@ TEST(Vic2World_States_StateDefinitionsTests, GetAllProvincesReturnsProvincesForM
 }
 
 
+TEST(Vic2World_States_StateDefinitionsTests, GetStateProvincesReturnsNoProvincesForMissingState)
+{
+	const auto stateDefinitions = *Vic2::StateDefinitions::Builder().build();
+
+	ASSERT_TRUE(stateDefinitions.getStateProvinces(1).empty());
+}
+
+
+TEST(Vic2World_States_StateDefinitionsTests, GetStateProvincesReturnsProvincesForMatchedState)
+{
+	const auto stateDefinitions =
+		 *Vic2::StateDefinitions::Builder().setStateMap({{1, {1, 2, 3}}, {2, {1, 2, 3}}, {4, {4}}}).build();
+
+	const auto provinces = stateDefinitions.getStateProvinces(1);
+	ASSERT_EQ(std::vector({1, 2, 3}), std::vector(provinces.begin(), provinces.end()));
+}
+
+
+TEST(Vic2World_States_StateDefinitionsTests, ProvincesInTheSameStateShareTheirProvinces)
+{
+	const auto stateDefinitions =
+		 *Vic2::StateDefinitions::Builder().setStateMap({{1, {1, 2, 3}}, {2, {1, 2, 3}}, {4, {4}}}).build();
+
+	ASSERT_EQ(stateDefinitions.getStateProvinces(1).data(), stateDefinitions.getStateProvinces(2).data());
+	ASSERT_NE(stateDefinitions.getStateProvinces(1).data(), stateDefinitions.getStateProvinces(4).data());
+}
+
+
 TEST(Vic2World_States_StateDefinitionsTests, GetStateIdReturnsNulloptForUnmatchedProvince)
 {
 	const auto stateDefinitions = *Vic2::StateDefinitions::Builder().build();
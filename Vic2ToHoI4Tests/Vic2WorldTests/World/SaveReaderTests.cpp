@@ -0,0 +1,118 @@
+#include "V2World/World/SaveReader.h"
+#include "gtest/gtest.h"
+#include <cstdio>
+#include <fstream>
+
+
+
+TEST(Vic2World_World_SaveReaderTests, MissingSaveHasNoItems)
+{
+	const Vic2::SaveReader save("V2World/MissingWorld.v2");
+
+	ASSERT_TRUE(save.getItems().empty());
+}
+
+
+TEST(Vic2World_World_SaveReaderTests, ItemsAreFoundInSaveOrder)
+{
+	const Vic2::SaveReader save("V2World/TestWorld.v2");
+
+	std::vector<std::string> keys;
+	for (const auto& item: save.getItems())
+	{
+		keys.emplace_back(item.key);
+	}
+
+	const std::vector<std::string> expectedKeys{"date",
+		 "great_nations",
+		 "1",
+		 "2",
+		 "3",
+		 "4",
+		 "5",
+		 "6",
+		 "ONE",
+		 "TWO",
+		 "NON",
+		 "NOT",
+		 "DED",
+		 "diplomacy",
+		 "active_war"};
+	ASSERT_EQ(expectedKeys, keys);
+}
+
+
+TEST(Vic2World_World_SaveReaderTests, ItemsAreClassifiedByKey)
+{
+	const Vic2::SaveReader save("V2World/TestWorld.v2");
+	const auto& items = save.getItems();
+
+	ASSERT_EQ(15, items.size());
+	ASSERT_EQ(Vic2::SaveReader::ItemType::Date, items[0].type);
+	ASSERT_EQ(Vic2::SaveReader::ItemType::GreatNations, items[1].type);
+	ASSERT_EQ(Vic2::SaveReader::ItemType::Province, items[2].type);
+	ASSERT_EQ(Vic2::SaveReader::ItemType::Country, items[8].type);
+	ASSERT_EQ(Vic2::SaveReader::ItemType::Diplomacy, items[13].type);
+	ASSERT_EQ(Vic2::SaveReader::ItemType::ActiveWar, items[14].type);
+}
+
+
+TEST(Vic2World_World_SaveReaderTests, ValuesStartAfterKey)
+{
+	const Vic2::SaveReader save("V2World/TestWorld.v2");
+	const auto& items = save.getItems();
+
+	ASSERT_EQ(R"(="2020.12.18")", items[0].value);
+	ASSERT_EQ("={ 1 42 }", items[1].value);
+	ASSERT_EQ(" = {\n\towner=\"HUH\"\n}", items[4].value);
+}
+
+
+TEST(Vic2World_World_SaveReaderTests, BracesInCommentsAndStringsAreSkipped)
+{
+	{
+		std::ofstream saveFile("SaveReaderTest.v2", std::ios::binary);
+		saveFile << "\xEF\xBB\xBF";
+		saveFile << "1 = {\n";
+		saveFile << "\tname=\"}\" # }\n";
+		saveFile << "}\n";
+		saveFile << "# 2 = { }\n";
+		saveFile << "player=\"ENG\"\n";
+		saveFile << "unused = { ENG = { } }\n";
+		saveFile << "lowercase = { }\n";
+		saveFile << "\"QUO\" = { }\n";
+		saveFile << "1234567890 = { }\n";
+		saveFile << "ENG = {\n";
+		saveFile << "\tcapital=1\n";
+	}
+
+	const Vic2::SaveReader save("SaveReaderTest.v2");
+	std::remove("SaveReaderTest.v2");
+	const auto& items = save.getItems();
+
+	ASSERT_EQ(2, items.size());
+	ASSERT_EQ("1", items[0].key);
+	ASSERT_EQ(" = {\n\tname=\"}\" # }\n}", items[0].value);
+	ASSERT_EQ("ENG", items[1].key);
+	ASSERT_EQ(" = {\n\tcapital=1\n", items[1].value);
+}
+
+
+TEST(Vic2World_World_SaveReaderTests, MemoryStreamReadsText)
+{
+	Vic2::MemoryStream theStream("= { 1 2 }");
+
+	std::string first;
+	std::string second;
+	theStream >> first >> second;
+	ASSERT_EQ("=", first);
+	ASSERT_EQ("{", second);
+
+	const auto position = theStream.tellg();
+	int number = 0;
+	theStream >> number;
+	ASSERT_EQ(1, number);
+	theStream.seekg(position);
+	theStream >> number;
+	ASSERT_EQ(1, number);
+}
\ No newline at end of file
@@ -99,6 +99,43 @@ TEST(Vic2World_World_WorldTests, CountriesCanBeAdded)
 }
 
 
+TEST(Vic2World_World_WorldTests, ParsingOnSeveralThreadsMatchesParsingOnOne)
+{
+	const auto serialWorld = Vic2::World::Factory(*Configuration::Builder().setVic2Path("V2World").build()).importWorld(
+		 *Configuration::Builder()
+				.setVic2Path("V2World")
+				.setInputFile("V2World/TestWorld.v2")
+				.setRemoveCores(false)
+				.setNumberOfThreads(1)
+				.build(),
+		 *Mappers::ProvinceMapper::Builder().Build());
+	const auto splitWorld = Vic2::World::Factory(*Configuration::Builder().setVic2Path("V2World").build()).importWorld(
+		 *Configuration::Builder()
+				.setVic2Path("V2World")
+				.setInputFile("V2World/TestWorld.v2")
+				.setRemoveCores(false)
+				.setNumberOfThreads(4)
+				.build(),
+		 *Mappers::ProvinceMapper::Builder().Build());
+
+	ASSERT_EQ(serialWorld->getProvinces().size(), splitWorld->getProvinces().size());
+	for (const auto& [provinceNum, province]: serialWorld->getProvinces())
+	{
+		const auto splitProvince = splitWorld->getProvince(provinceNum);
+		ASSERT_TRUE(splitProvince);
+		ASSERT_EQ(province->getOwner(), (*splitProvince)->getOwner());
+		ASSERT_EQ(province->getCores(), (*splitProvince)->getCores());
+	}
+	ASSERT_EQ(serialWorld->getCountries().size(), splitWorld->getCountries().size());
+	for (const auto& [tag, country]: serialWorld->getCountries())
+	{
+		ASSERT_TRUE(splitWorld->getCountries().contains(tag));
+		ASSERT_EQ(country.getPrimaryCulture(), splitWorld->getCountries().at(tag).getPrimaryCulture());
+	}
+	ASSERT_EQ(serialWorld->getGreatPowers(), splitWorld->getGreatPowers());
+}
+
+
 TEST(Vic2World_World_WorldTests, InvalidCountriesAreLogged)
 {
 	std::stringstream log;